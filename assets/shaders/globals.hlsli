@@ -173,6 +173,26 @@ struct RwArrayBuffer {
     }
 };
 
+// NOTE: Sub-range of a frame allocator slot, only valid during the frame it was allocated in
+struct TransientBuffer {
+    ResourceHandle handle;
+    uint offset;
+
+    template <typename T>
+    T load() {
+        ByteAddressBuffer buffer = DESCRIPTOR_HEAP(ByteAddressBufferHandle, this.handle.read_index());
+        T result = buffer.Load<T>(this.offset);
+        return result;
+    }
+
+    template <typename T>
+    T load(uint index) {
+        ByteAddressBuffer buffer = DESCRIPTOR_HEAP(ByteAddressBufferHandle, this.handle.read_index());
+        T result = buffer.Load<T>(this.offset + sizeof(T) * index);
+        return result;
+    }
+};
+
 struct Texture {
     ResourceHandle handle;
 
@@ -309,15 +329,41 @@ struct RwTexture {
 
 #undef DESCRIPTOR_HEAP
 
+////////////////////////////////////////////////////////////////////////////////
+// Buffer Device Address
+////////////////////////////////////////////////////////////////////////////////
+
+// NOTE: Raw buffer loads only exist in SPIR-V, other backends keep reading through descriptors
+#if defined(HE_VULKAN) && defined(HE_BUFFER_DEVICE_ADDRESS)
+    #define HE_BUFFER_POINTERS
+#endif
+
+#ifdef HE_BUFFER_POINTERS
+struct BufferPointer {
+    uint64_t address;
+
+    template <typename T>
+    T load(uint index) {
+        return vk::RawBufferLoad<T>(address + sizeof(T) * index);
+    }
+};
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Shader Interop
 ////////////////////////////////////////////////////////////////////////////////
 
+// NOTE: Buffer references are 64-bit wide in both modes, so the layout matches the CPU side
 struct Mesh {
+#ifdef HE_BUFFER_POINTERS
+    BufferPointer positions;
+    BufferPointer normals;
+#else
     ArrayBuffer positions;
-    ArrayBuffer normals;
     uint padding_0;
+    ArrayBuffer normals;
     uint padding_1;
+#endif
 
     inline float4 get_position(uint index) {
         return positions.load<float4>(index);
@@ -334,20 +380,22 @@ struct Material {
     // TODO: Add textures
 };
 
-////////////////////////////////////////////////////////////////////////////////
-// Push Constants
-////////////////////////////////////////////////////////////////////////////////
+struct Object {
+#ifdef HE_BUFFER_POINTERS
+    BufferPointer mesh;
+    BufferPointer material;
 
-#ifdef HE_VULKAN
-    #define HE_PUSH_CONSTANT(value_type, name) [[vk::push_constant]] value_type name
-#else
-    #define HE_PUSH_CONSTANT(value_type, name) ConstantBuffer<value_type> name : register(b0, space0)
-#endif
+    inline Mesh get_mesh() {
+        return mesh.load<Mesh>(0);
+    }
 
-struct ObjectPushConstants {
+    inline Material get_material() {
+        return material.load<Material>(0);
+    }
+#else
     uint mesh;
-    uint material;
     uint padding_0;
+    uint material;
     uint padding_1;
 
     inline Mesh get_mesh() {
@@ -361,6 +409,27 @@ struct ObjectPushConstants {
         SimpleBuffer buffer = (SimpleBuffer) material_handle.read_index();
         return buffer.load<Material>();
     }
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Push Constants
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef HE_VULKAN
+    #define HE_PUSH_CONSTANT(value_type, name) [[vk::push_constant]] value_type name
+#else
+    #define HE_PUSH_CONSTANT(value_type, name) ConstantBuffer<value_type> name : register(b0, space0)
+#endif
+
+// NOTE: Indirect draws store the object index as their first instance, which SV_InstanceID includes on Vulkan
+struct DrawPushConstants {
+    TransientBuffer objects;
+    TransientBuffer frame;
+
+    inline Object get_object(uint instance_id) {
+        return objects.load<Object>(instance_id);
+    }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -391,6 +460,10 @@ inline Frame get_frame() {
     return buffer.load<Frame>();
 }
 
+inline Frame get_frame(TransientBuffer buffer) {
+    return buffer.load<Frame>();
+}
+
 #undef DESCRIPTOR_SET_SLOT_FRAME
 
 struct Camera {
@@ -406,6 +479,10 @@ inline Camera get_camera() {
     return buffer.load<Camera>();
 }
 
+inline Camera get_camera(TransientBuffer buffer) {
+    return buffer.load<Camera>();
+}
+
 #undef DESCRIPTOR_SET_SLOT_CAMERA
 
 #endif
@@ -6,7 +6,7 @@
 
 #include "globals.hlsli"
 
-HE_PUSH_CONSTANT(ObjectPushConstants, g_push);
+HE_PUSH_CONSTANT(DrawPushConstants, g_push);
 
 struct VertexOutput {
     float4 position : SV_POSITION;
@@ -14,12 +14,15 @@ struct VertexOutput {
 };
 
 VertexOutput vs_main(
-  uint vertex_id : SV_VertexID
+  uint vertex_id : SV_VertexID,
+  uint instance_id : SV_InstanceID
 ) {
-    const Mesh mesh = g_push.get_mesh();
+    const Object object = g_push.get_object(instance_id);
+
+    const Mesh mesh = object.get_mesh();
     const float4 position = mesh.get_position(vertex_id);
 
-    const Material material = g_push.get_material();
+    const Material material = object.get_material();
     const float4 base_color = material.base_color;
 
     VertexOutput output = (VertexOutput) 0;
@@ -6,10 +6,15 @@
 
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace hyper_core::filesystem
 {
     [[nodiscard]] std::vector<uint8_t> read_file(const std::string &file_path);
+
+    // NOTE: Writes to a temporary file first and renames it, so readers never observe a partially written file
+    [[nodiscard]] bool write_file(const std::string &file_path, std::span<const uint8_t> bytes);
 } // namespace hyper_core::filesystem
\ No newline at end of file
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace hyper_core::hash
+{
+    static constexpr uint64_t s_fnv1a_offset_basis = 0xCBF29CE484222325;
+    static constexpr uint64_t s_fnv1a_prime = 0x00000100000001B3;
+
+    [[nodiscard]] uint64_t fnv1a(std::span<const uint8_t> bytes, uint64_t seed = s_fnv1a_offset_basis);
+    [[nodiscard]] uint64_t fnv1a(std::string_view string, uint64_t seed = s_fnv1a_offset_basis);
+
+    [[nodiscard]] uint64_t combine(uint64_t seed, uint64_t value);
+} // namespace hyper_core::hash
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace hyper_core
+{
+    // NOTE: Unbounded lock-free queue for any number of producer threads and exactly one consumer thread
+    template <typename T>
+    class MpscQueue
+    {
+    private:
+        struct Node
+        {
+            std::atomic<Node *> next;
+            T value;
+        };
+
+    public:
+        MpscQueue()
+            : m_head(nullptr)
+            , m_tail(nullptr)
+        {
+            Node *stub = new Node{ nullptr, T() };
+            m_head.store(stub, std::memory_order_relaxed);
+            m_tail = stub;
+        }
+
+        ~MpscQueue()
+        {
+            while (this->pop().has_value())
+            {
+            }
+
+            delete m_tail;
+        }
+
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        void push(T value)
+        {
+            Node *node = new Node{ nullptr, std::move(value) };
+
+            Node *previous = m_head.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        [[nodiscard]] std::optional<T> pop()
+        {
+            Node *tail = m_tail;
+            Node *next = tail->next.load(std::memory_order_acquire);
+            if (next == nullptr)
+            {
+                return std::nullopt;
+            }
+
+            T value = std::move(next->value);
+            m_tail = next;
+            delete tail;
+
+            return value;
+        }
+
+    private:
+        alignas(64) std::atomic<Node *> m_head;
+        alignas(64) Node *m_tail;
+    };
+} // namespace hyper_core
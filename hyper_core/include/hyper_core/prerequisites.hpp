@@ -12,6 +12,9 @@
 #define HE_STRINGIFY(x) HE_STRINGIFY_HELPER(x)
 #define HE_EXPAND_MACRO(x) x
 
+#define HE_CONCAT_HELPER(a, b) a##b
+#define HE_CONCAT(a, b) HE_CONCAT_HELPER(a, b)
+
 #define HE_BIND_FUNCTION(function)                                    \
     [this](auto &&...args) -> decltype(auto)                          \
     {                                                                 \
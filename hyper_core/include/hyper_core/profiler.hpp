@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "hyper_core/prerequisites.hpp"
+
+namespace hyper_core
+{
+    struct ProfileCounter
+    {
+        std::string name;
+        uint64_t value = 0;
+    };
+
+    struct ProfileScope
+    {
+        std::string name;
+        std::string track;
+        uint32_t depth = 0;
+
+        // NOTE: Relative to the start of the frame the scope belongs to
+        double start_milliseconds = 0.0;
+        double duration_milliseconds = 0.0;
+
+        std::vector<ProfileCounter> counters;
+    };
+
+    struct FrameProfile
+    {
+        uint64_t frame_index = 0;
+        double start_milliseconds = 0.0;
+        double cpu_milliseconds = 0.0;
+        double gpu_milliseconds = 0.0;
+
+        std::vector<ProfileScope> cpu_scopes;
+        std::vector<ProfileScope> gpu_scopes;
+    };
+
+    class Profiler
+    {
+    public:
+        static void set_enabled(bool enabled);
+        [[nodiscard]] static bool enabled();
+
+        // NOTE: Resolved frames are written as Chrome trace events, which chrome://tracing and Perfetto can open
+        static void open_trace(const std::string &file_path);
+        static void close_trace();
+
+        static void begin_frame(uint64_t frame_index);
+
+        static void begin_scope(std::string_view name);
+        static void end_scope();
+
+        // NOTE: GPU results arrive a few frames late, the frame is resolved once they are merged in
+        static void submit_gpu_scopes(uint64_t frame_index, std::vector<ProfileScope> scopes);
+
+        [[nodiscard]] static std::optional<FrameProfile> last_frame();
+    };
+
+    class ScopedProfile
+    {
+    public:
+        explicit ScopedProfile(std::string_view name);
+        ~ScopedProfile();
+
+        ScopedProfile(const ScopedProfile &) = delete;
+        ScopedProfile &operator=(const ScopedProfile &) = delete;
+
+    private:
+        bool m_active;
+    };
+} // namespace hyper_core
+
+#define HE_PROFILE_SCOPE(name) const ::hyper_core::ScopedProfile HE_CONCAT(profile_scope_, __LINE__)(name)
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "hyper_core/assertion.hpp"
+
+namespace hyper_core
+{
+    // NOTE: Bounded lock-free queue for exactly one producer thread and one consumer thread
+    template <typename T>
+    class SpscQueue
+    {
+    public:
+        explicit SpscQueue(const size_t capacity)
+            : m_head(0)
+            , m_tail(0)
+            , m_mask(capacity - 1)
+            , m_buffer(capacity)
+        {
+            HE_ASSERT(capacity != 0 && (capacity & (capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+        }
+
+        [[nodiscard]] bool push(const T &value)
+        {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) == m_buffer.size())
+            {
+                return false;
+            }
+
+            m_buffer[tail & m_mask] = value;
+            m_tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        [[nodiscard]] std::optional<T> pop()
+        {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire))
+            {
+                return std::nullopt;
+            }
+
+            T value = std::move(m_buffer[head & m_mask]);
+            m_head.store(head + 1, std::memory_order_release);
+
+            return value;
+        }
+
+    private:
+        alignas(64) std::atomic<size_t> m_head;
+        alignas(64) std::atomic<size_t> m_tail;
+
+        size_t m_mask;
+        std::vector<T> m_buffer;
+    };
+} // namespace hyper_core
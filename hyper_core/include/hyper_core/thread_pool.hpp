@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace hyper_core
+{
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(uint32_t thread_count = ThreadPool::default_thread_count());
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        template <typename F>
+        [[nodiscard]] std::future<std::invoke_result_t<F>> submit(F &&function)
+        {
+            using R = std::invoke_result_t<F>;
+
+            // NOTE: std::function needs copyable targets, so the move-only task lives behind a shared pointer
+            const std::shared_ptr<std::packaged_task<R()>> task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(function));
+            std::future<R> future = task->get_future();
+
+            {
+                const std::lock_guard lock(m_mutex);
+                m_tasks.emplace_back(
+                    [task]()
+                    {
+                        (*task)();
+                    });
+            }
+
+            m_condition.notify_one();
+
+            return future;
+        }
+
+        // NOTE: Blocks until the queue is empty and no worker is running a task anymore
+        void wait_for_idle();
+
+        [[nodiscard]] uint32_t thread_count() const;
+
+        [[nodiscard]] static uint32_t default_thread_count();
+
+    private:
+        void run_worker(const std::stop_token &stop_token);
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable_any m_condition;
+        std::condition_variable m_idle_condition;
+        std::deque<std::function<void()>> m_tasks;
+        uint32_t m_active_task_count;
+
+        std::vector<std::jthread> m_threads;
+    };
+} // namespace hyper_core
@@ -6,6 +6,7 @@
 
 #include "hyper_core/filesystem.hpp"
 
+#include <filesystem>
 #include <fstream>
 
 namespace hyper_core::filesystem
@@ -26,4 +27,33 @@ namespace hyper_core::filesystem
 
         return data;
     }
+
+    bool write_file(const std::string &file_path, const std::span<const uint8_t> bytes)
+    {
+        const std::string temporary_file_path = file_path + ".tmp";
+
+        {
+            std::ofstream file(temporary_file_path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                return false;
+            }
+
+            file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!file.good())
+            {
+                return false;
+            }
+        }
+
+        std::error_code error_code;
+        std::filesystem::rename(temporary_file_path, file_path, error_code);
+        if (error_code)
+        {
+            std::filesystem::remove(temporary_file_path, error_code);
+            return false;
+        }
+
+        return true;
+    }
 } // namespace hyper_core::filesystem
\ No newline at end of file
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/hash.hpp"
+
+namespace hyper_core::hash
+{
+    uint64_t fnv1a(const std::span<const uint8_t> bytes, const uint64_t seed)
+    {
+        uint64_t hash = seed;
+        for (const uint8_t byte : bytes)
+        {
+            hash ^= byte;
+            hash *= s_fnv1a_prime;
+        }
+
+        return hash;
+    }
+
+    uint64_t fnv1a(const std::string_view string, const uint64_t seed)
+    {
+        return fnv1a(std::span(reinterpret_cast<const uint8_t *>(string.data()), string.size()), seed);
+    }
+
+    uint64_t combine(const uint64_t seed, const uint64_t value)
+    {
+        return seed ^ (value + 0x9E3779B97F4A7C15 + (seed << 6) + (seed >> 2));
+    }
+} // namespace hyper_core::hash
@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+#include "hyper_core/logger.hpp"
+
+namespace hyper_core
+{
+    struct OpenScope
+    {
+        std::string name;
+        std::chrono::steady_clock::time_point start_time;
+    };
+
+    // NOTE: Frames without GPU results are resolved CPU-only once this many newer frames began
+    static constexpr size_t s_max_pending_frames = 4;
+
+    static const std::chrono::steady_clock::time_point g_epoch = std::chrono::steady_clock::now();
+
+    static std::atomic<bool> g_enabled = false;
+
+    static std::mutex g_mutex;
+    static std::deque<FrameProfile> g_pending_frames;
+    static std::optional<FrameProfile> g_last_frame;
+    static std::unordered_map<std::thread::id, uint32_t> g_thread_indices;
+
+    static std::ofstream g_trace_file;
+    static bool g_trace_first_event = true;
+    static std::unordered_map<std::string, uint32_t> g_trace_tracks;
+
+    static thread_local std::vector<OpenScope> g_open_scopes;
+
+    static double milliseconds_since_epoch(const std::chrono::steady_clock::time_point time_point)
+    {
+        return std::chrono::duration<double, std::milli>(time_point - g_epoch).count();
+    }
+
+    static std::string escape_json(const std::string_view string)
+    {
+        std::string escaped;
+        escaped.reserve(string.size());
+        for (const char character : string)
+        {
+            switch (character)
+            {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            default:
+                escaped += character;
+                break;
+            }
+        }
+
+        return escaped;
+    }
+
+    static void write_trace_event(const std::string &event)
+    {
+        g_trace_file << (g_trace_first_event ? "\n" : ",\n") << event;
+        g_trace_first_event = false;
+    }
+
+    static uint32_t trace_track(const std::string &track)
+    {
+        const auto track_iterator = g_trace_tracks.find(track);
+        if (track_iterator != g_trace_tracks.end())
+        {
+            return track_iterator->second;
+        }
+
+        const uint32_t track_id = static_cast<uint32_t>(g_trace_tracks.size());
+        g_trace_tracks[track] = track_id;
+
+        write_trace_event(fmt::format(
+            R"({{"name":"thread_name","ph":"M","pid":0,"tid":{},"args":{{"name":"{}"}}}})",
+            track_id,
+            escape_json(track)));
+
+        return track_id;
+    }
+
+    static void write_trace_scopes(const FrameProfile &frame, const std::vector<ProfileScope> &scopes)
+    {
+        for (const ProfileScope &scope : scopes)
+        {
+            std::string arguments = fmt::format(R"("frame":{})", frame.frame_index);
+            for (const ProfileCounter &counter : scope.counters)
+            {
+                arguments += fmt::format(R"(,"{}":{})", escape_json(counter.name), counter.value);
+            }
+
+            // NOTE: Chrome traces are in microseconds
+            const uint32_t track_id = trace_track(scope.track);
+            write_trace_event(fmt::format(
+                R"({{"name":"{}","ph":"X","pid":0,"tid":{},"ts":{:.3f},"dur":{:.3f},"args":{{{}}}}})",
+                escape_json(scope.name),
+                track_id,
+                (frame.start_milliseconds + scope.start_milliseconds) * 1000.0,
+                scope.duration_milliseconds * 1000.0,
+                arguments));
+        }
+    }
+
+    static void resolve_frame(FrameProfile frame)
+    {
+        std::string gpu_passes;
+        for (const ProfileScope &scope : frame.gpu_scopes)
+        {
+            if (scope.depth != 0)
+            {
+                continue;
+            }
+
+            gpu_passes += fmt::format("{}{} {:.3f} ms", gpu_passes.empty() ? "" : ", ", scope.name, scope.duration_milliseconds);
+        }
+
+        HE_TRACE(
+            "Frame {}: CPU {:.3f} ms, GPU {:.3f} ms{}",
+            frame.frame_index,
+            frame.cpu_milliseconds,
+            frame.gpu_milliseconds,
+            gpu_passes.empty() ? "" : fmt::format(" ({})", gpu_passes));
+
+        if (g_trace_file.is_open())
+        {
+            write_trace_scopes(frame, frame.cpu_scopes);
+            write_trace_scopes(frame, frame.gpu_scopes);
+        }
+
+        g_last_frame = std::move(frame);
+    }
+
+    void Profiler::set_enabled(const bool enabled)
+    {
+        g_enabled = enabled;
+    }
+
+    bool Profiler::enabled()
+    {
+        return g_enabled;
+    }
+
+    void Profiler::open_trace(const std::string &file_path)
+    {
+        const std::scoped_lock lock(g_mutex);
+
+        g_trace_file.open(file_path, std::ios::out | std::ios::trunc);
+        if (!g_trace_file.is_open())
+        {
+            HE_ERROR("Failed to open trace file '{}'", file_path);
+            return;
+        }
+
+        g_trace_file << "[";
+        g_trace_first_event = true;
+        g_trace_tracks.clear();
+    }
+
+    void Profiler::close_trace()
+    {
+        const std::scoped_lock lock(g_mutex);
+
+        while (!g_pending_frames.empty())
+        {
+            resolve_frame(std::move(g_pending_frames.front()));
+            g_pending_frames.pop_front();
+        }
+
+        if (!g_trace_file.is_open())
+        {
+            return;
+        }
+
+        g_trace_file << "\n]\n";
+        g_trace_file.close();
+    }
+
+    void Profiler::begin_frame(const uint64_t frame_index)
+    {
+        if (!g_enabled)
+        {
+            return;
+        }
+
+        const double now = milliseconds_since_epoch(std::chrono::steady_clock::now());
+
+        const std::scoped_lock lock(g_mutex);
+
+        if (!g_pending_frames.empty())
+        {
+            FrameProfile &previous_frame = g_pending_frames.back();
+            previous_frame.cpu_milliseconds = now - previous_frame.start_milliseconds;
+        }
+
+        g_pending_frames.push_back({
+            .frame_index = frame_index,
+            .start_milliseconds = now,
+            .cpu_milliseconds = 0.0,
+            .gpu_milliseconds = 0.0,
+            .cpu_scopes = {},
+            .gpu_scopes = {},
+        });
+
+        while (g_pending_frames.size() > s_max_pending_frames)
+        {
+            resolve_frame(std::move(g_pending_frames.front()));
+            g_pending_frames.pop_front();
+        }
+    }
+
+    void Profiler::begin_scope(const std::string_view name)
+    {
+        g_open_scopes.push_back({
+            .name = std::string(name),
+            .start_time = std::chrono::steady_clock::now(),
+        });
+    }
+
+    void Profiler::end_scope()
+    {
+        if (g_open_scopes.empty())
+        {
+            return;
+        }
+
+        const std::chrono::steady_clock::time_point end_time = std::chrono::steady_clock::now();
+
+        OpenScope open_scope = std::move(g_open_scopes.back());
+        g_open_scopes.pop_back();
+
+        const std::scoped_lock lock(g_mutex);
+
+        if (g_pending_frames.empty())
+        {
+            return;
+        }
+
+        const auto [thread_index, inserted] =
+            g_thread_indices.try_emplace(std::this_thread::get_id(), static_cast<uint32_t>(g_thread_indices.size()));
+        HE_UNUSED(inserted);
+
+        FrameProfile &frame = g_pending_frames.back();
+        frame.cpu_scopes.push_back({
+            .name = std::move(open_scope.name),
+            .track = fmt::format("CPU Thread {}", thread_index->second),
+            .depth = static_cast<uint32_t>(g_open_scopes.size()),
+            .start_milliseconds = milliseconds_since_epoch(open_scope.start_time) - frame.start_milliseconds,
+            .duration_milliseconds = std::chrono::duration<double, std::milli>(end_time - open_scope.start_time).count(),
+            .counters = {},
+        });
+    }
+
+    void Profiler::submit_gpu_scopes(const uint64_t frame_index, std::vector<ProfileScope> scopes)
+    {
+        const std::scoped_lock lock(g_mutex);
+
+        const auto frame_iterator = std::find_if(
+            g_pending_frames.begin(),
+            g_pending_frames.end(),
+            [frame_index](const FrameProfile &frame)
+            {
+                return frame.frame_index == frame_index;
+            });
+        if (frame_iterator == g_pending_frames.end())
+        {
+            return;
+        }
+
+        // NOTE: Top-level scopes of one queue don't overlap, so their sum is the busy time of the frame
+        double gpu_milliseconds = 0.0;
+        for (const ProfileScope &scope : scopes)
+        {
+            if (scope.depth == 0)
+            {
+                gpu_milliseconds += scope.duration_milliseconds;
+            }
+        }
+
+        frame_iterator->gpu_milliseconds = gpu_milliseconds;
+        frame_iterator->gpu_scopes = std::move(scopes);
+
+        // NOTE: The frame being recorded is never resolved, its CPU time isn't known yet
+        const auto resolve_end = std::min(std::next(frame_iterator), std::prev(g_pending_frames.end()));
+        for (auto frame = g_pending_frames.begin(); frame != resolve_end; ++frame)
+        {
+            resolve_frame(std::move(*frame));
+        }
+
+        g_pending_frames.erase(g_pending_frames.begin(), resolve_end);
+    }
+
+    std::optional<FrameProfile> Profiler::last_frame()
+    {
+        const std::scoped_lock lock(g_mutex);
+
+        return g_last_frame;
+    }
+
+    ScopedProfile::ScopedProfile(const std::string_view name)
+        : m_active(Profiler::enabled())
+    {
+        if (m_active)
+        {
+            Profiler::begin_scope(name);
+        }
+    }
+
+    ScopedProfile::~ScopedProfile()
+    {
+        if (m_active)
+        {
+            Profiler::end_scope();
+        }
+    }
+} // namespace hyper_core
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_core/thread_pool.hpp"
+
+#include <algorithm>
+
+#include "hyper_core/assertion.hpp"
+
+namespace hyper_core
+{
+    ThreadPool::ThreadPool(const uint32_t thread_count)
+        : m_mutex()
+        , m_condition()
+        , m_idle_condition()
+        , m_tasks()
+        , m_active_task_count(0)
+        , m_threads()
+    {
+        HE_ASSERT(thread_count > 0);
+
+        m_threads.reserve(thread_count);
+        for (uint32_t index = 0; index < thread_count; ++index)
+        {
+            m_threads.emplace_back(
+                [this](const std::stop_token &stop_token)
+                {
+                    this->run_worker(stop_token);
+                });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        for (std::jthread &thread : m_threads)
+        {
+            thread.request_stop();
+        }
+
+        m_condition.notify_all();
+        m_threads.clear();
+    }
+
+    void ThreadPool::wait_for_idle()
+    {
+        std::unique_lock lock(m_mutex);
+        m_idle_condition.wait(
+            lock,
+            [this]()
+            {
+                return m_tasks.empty() && m_active_task_count == 0;
+            });
+    }
+
+    uint32_t ThreadPool::thread_count() const
+    {
+        return static_cast<uint32_t>(m_threads.size());
+    }
+
+    uint32_t ThreadPool::default_thread_count()
+    {
+        // NOTE: One hardware thread is left for the main and frame threads
+        const uint32_t hardware_thread_count = std::thread::hardware_concurrency();
+        return std::max(hardware_thread_count, 2u) - 1;
+    }
+
+    void ThreadPool::run_worker(const std::stop_token &stop_token)
+    {
+        while (true)
+        {
+            std::function<void()> task;
+
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(
+                    lock,
+                    stop_token,
+                    [this]()
+                    {
+                        return !m_tasks.empty();
+                    });
+
+                if (m_tasks.empty())
+                {
+                    return;
+                }
+
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+                ++m_active_task_count;
+            }
+
+            task();
+
+            {
+                const std::lock_guard lock(m_mutex);
+                --m_active_task_count;
+                if (!m_tasks.empty() || m_active_task_count != 0)
+                {
+                    continue;
+                }
+            }
+
+            m_idle_condition.notify_all();
+        }
+    }
+} // namespace hyper_core
@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <string>
 
+#include <hyper_core/thread_pool.hpp>
 #include <hyper_event/event_bus.hpp>
 #include <hyper_platform/window_events.hpp>
 #include <hyper_platform/window.hpp>
@@ -22,24 +25,39 @@ namespace hyper_engine
         uint32_t width;
         uint32_t height;
         hyper_rhi::GraphicsApi graphics_api;
+        std::string gpu;
         bool debug;
+        bool threaded_events;
+        uint32_t frame_count;
+        hyper_rhi::PresentMode present_mode;
+        bool low_latency;
+        bool hot_reload;
+        bool buffer_device_address;
+        bool profile;
+        std::string trace_path;
     };
 
     class Engine
     {
     public:
         explicit Engine(const EngineDescriptor &descriptor);
+        ~Engine();
 
         void run();
 
     private:
+        void run_frames();
+
         void on_close(const hyper_platform::WindowCloseEvent &event);
         void on_resize(const hyper_platform::WindowResizeEvent &event);
 
     private:
         std::chrono::steady_clock::time_point m_start_time;
 
-        bool m_running;
+        std::atomic<bool> m_running;
+        bool m_threaded_events;
+        bool m_low_latency;
+        hyper_core::ThreadPool m_thread_pool;
         hyper_event::EventBus m_event_bus;
         hyper_platform::Window m_window;
         hyper_rhi::GraphicsDeviceHandle m_graphics_device;
@@ -7,36 +7,57 @@
 #include "hyper_engine/engine.hpp"
 
 #include <chrono>
+#include <thread>
 
 #include <hyper_core/assertion.hpp>
 #include <hyper_core/logger.hpp>
 #include <hyper_core/prerequisites.hpp>
+#include <hyper_core/profiler.hpp>
 
 namespace hyper_engine
 {
     Engine::Engine(const EngineDescriptor &descriptor)
         : m_start_time(std::chrono::steady_clock::now())
         , m_running(false)
+        , m_threaded_events(descriptor.threaded_events)
+        , m_low_latency(descriptor.low_latency)
+        , m_thread_pool()
         , m_window({
               .title = "HyperEngine",
               .width = descriptor.width,
               .height = descriptor.height,
               .event_bus = m_event_bus,
+              .queue_events = descriptor.threaded_events,
           })
         , m_graphics_device(hyper_rhi::GraphicsDevice::create({
               .graphics_api = descriptor.graphics_api,
               .debug_mode = descriptor.debug,
+              .frame_count = descriptor.frame_count,
+              .adapter = descriptor.gpu,
+              .thread_pool = &m_thread_pool,
           }))
         , m_surface(m_graphics_device->create_surface({
               .window = m_window,
+              .present_mode = descriptor.present_mode,
           }))
         , m_renderer({
               .graphics_device = m_graphics_device,
               .surface = m_surface,
+              .thread_pool = &m_thread_pool,
+              .width = descriptor.width,
+              .height = descriptor.height,
+              .hot_reload = descriptor.hot_reload,
+              .buffer_device_address = descriptor.buffer_device_address,
           })
     {
         HE_ASSERT(m_graphics_device);
 
+        hyper_core::Profiler::set_enabled(descriptor.profile || !descriptor.trace_path.empty());
+        if (!descriptor.trace_path.empty())
+        {
+            hyper_core::Profiler::open_trace(descriptor.trace_path);
+        }
+
         m_event_bus.subscribe<hyper_platform::WindowCloseEvent>(HE_BIND_FUNCTION(Engine::on_close));
         m_event_bus.subscribe<hyper_platform::WindowResizeEvent>(HE_BIND_FUNCTION(Engine::on_resize));
 
@@ -48,7 +69,34 @@ namespace hyper_engine
         HE_INFO("Engine initialized in {:.2}s", elapsed_seconds.count());
     }
 
+    Engine::~Engine()
+    {
+        // NOTE: Queued tasks reference the renderer and the graphics device, which are destroyed before the pool
+        m_thread_pool.wait_for_idle();
+
+        hyper_core::Profiler::close_trace();
+    }
+
     void Engine::run()
+    {
+        if (!m_threaded_events)
+        {
+            this->run_frames();
+            return;
+        }
+
+        // NOTE: GLFW requires event processing on the main thread, so the frame loop moves to its own thread instead
+        std::thread frame_thread(HE_BIND_FUNCTION(Engine::run_frames));
+
+        while (m_running)
+        {
+            hyper_platform::Window::wait_events();
+        }
+
+        frame_thread.join();
+    }
+
+    void Engine::run_frames()
     {
         // float time = 0.0;
         constexpr auto delta_time = static_cast<float>(1.0 / 60.0);
@@ -64,7 +112,18 @@ namespace hyper_engine
 
             accumulator += frame_time;
 
-            hyper_platform::Window::poll_events();
+            // NOTE: Waiting for the frame slot before sampling input instead of in begin_frame keeps the input as fresh as possible
+            if (m_low_latency)
+            {
+                m_renderer.wait_for_frame();
+            }
+
+            if (!m_threaded_events)
+            {
+                hyper_platform::Window::poll_events();
+            }
+
+            m_window.dispatch_events();
 
             while (accumulator >= delta_time)
             {
@@ -79,6 +138,11 @@ namespace hyper_engine
             // Render
             m_renderer.render();
         }
+
+        if (m_threaded_events)
+        {
+            hyper_platform::Window::post_empty_event();
+        }
     }
 
     void Engine::on_close(const hyper_platform::WindowCloseEvent &)
@@ -89,5 +153,7 @@ namespace hyper_engine
     void Engine::on_resize(const hyper_platform::WindowResizeEvent &event)
     {
         HE_DEBUG("{}, {}", event.width(), event.height());
+
+        m_renderer.resize(event.width(), event.height());
     }
 } // namespace hyper_engine
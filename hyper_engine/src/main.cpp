@@ -25,11 +25,41 @@ int main(int argc, char **argv)
     program.add_argument("--height").default_value(static_cast<uint32_t>(720)).scan<'i', uint32_t>().store_into(height);
 
     std::string renderer = "vulkan";
-    program.add_argument("--renderer").default_value("vulkan").choices("d3d12", "vulkan").store_into(renderer);
+    program.add_argument("--renderer").default_value("vulkan").choices("d3d12", "null", "vulkan").store_into(renderer);
+
+    std::string gpu;
+    program.add_argument("--gpu").default_value("").store_into(gpu);
 
     bool debug = false;
     program.add_argument("--debug").default_value(false).implicit_value(true).store_into(debug);
 
+    bool threaded_events = false;
+    program.add_argument("--threaded-events").default_value(false).implicit_value(true).store_into(threaded_events);
+
+    uint32_t frame_count = 0;
+    program.add_argument("--frames-in-flight").default_value(static_cast<uint32_t>(2)).scan<'i', uint32_t>().store_into(frame_count);
+
+    std::string present_mode = "mailbox";
+    program.add_argument("--present-mode")
+        .default_value("mailbox")
+        .choices("fifo", "fifo_relaxed", "mailbox", "immediate")
+        .store_into(present_mode);
+
+    bool low_latency = false;
+    program.add_argument("--low-latency").default_value(false).implicit_value(true).store_into(low_latency);
+
+    bool hot_reload = false;
+    program.add_argument("--hot-reload").default_value(false).implicit_value(true).store_into(hot_reload);
+
+    bool buffer_device_address = false;
+    program.add_argument("--buffer-device-address").default_value(false).implicit_value(true).store_into(buffer_device_address);
+
+    bool profile = false;
+    program.add_argument("--profile").default_value(false).implicit_value(true).store_into(profile);
+
+    std::string trace_path;
+    program.add_argument("--trace").default_value("").store_into(trace_path);
+
     try
     {
         program.parse_args(argc, argv);
@@ -40,13 +70,64 @@ int main(int argc, char **argv)
         return 1;
     }
 
-    const hyper_rhi::GraphicsApi graphics_api = renderer == "d3d12" ? hyper_rhi::GraphicsApi::D3D12 : hyper_rhi::GraphicsApi::Vulkan;
+    if (frame_count < hyper_rhi::GraphicsDevice::s_min_frame_count || frame_count > hyper_rhi::GraphicsDevice::s_max_frame_count)
+    {
+        HE_ERROR(
+            "--frames-in-flight must be between {} and {}",
+            hyper_rhi::GraphicsDevice::s_min_frame_count,
+            hyper_rhi::GraphicsDevice::s_max_frame_count);
+        return 1;
+    }
+
+    const hyper_rhi::GraphicsApi graphics_api = [&renderer]()
+    {
+        if (renderer == "d3d12")
+        {
+            return hyper_rhi::GraphicsApi::D3D12;
+        }
+
+        if (renderer == "null")
+        {
+            return hyper_rhi::GraphicsApi::Null;
+        }
+
+        return hyper_rhi::GraphicsApi::Vulkan;
+    }();
+
+    const hyper_rhi::PresentMode surface_present_mode = [&present_mode]()
+    {
+        if (present_mode == "fifo")
+        {
+            return hyper_rhi::PresentMode::Fifo;
+        }
+
+        if (present_mode == "fifo_relaxed")
+        {
+            return hyper_rhi::PresentMode::FifoRelaxed;
+        }
+
+        if (present_mode == "immediate")
+        {
+            return hyper_rhi::PresentMode::Immediate;
+        }
+
+        return hyper_rhi::PresentMode::Mailbox;
+    }();
 
     auto engine = hyper_engine::Engine({
         .width = width,
         .height = height,
         .graphics_api = graphics_api,
+        .gpu = gpu,
         .debug = debug,
+        .threaded_events = threaded_events,
+        .frame_count = frame_count,
+        .present_mode = surface_present_mode,
+        .low_latency = low_latency,
+        .hot_reload = hot_reload,
+        .buffer_device_address = buffer_device_address,
+        .profile = profile,
+        .trace_path = trace_path,
     });
     engine.run();
 
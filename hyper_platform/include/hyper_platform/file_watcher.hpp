@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hyper_platform
+{
+    struct FileWatcherDescriptor
+    {
+        std::string directory;
+    };
+
+    class FileWatcher
+    {
+    public:
+        explicit FileWatcher(const FileWatcherDescriptor &descriptor);
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher &) = delete;
+        FileWatcher &operator=(const FileWatcher &) = delete;
+
+        // NOTE: Non-blocking, returns every file written since the last poll
+        [[nodiscard]] std::vector<std::string> poll();
+
+    private:
+        void add_watch(const std::string &directory);
+
+    private:
+        std::string m_directory;
+
+#if HE_LINUX
+        int m_file_descriptor;
+        std::unordered_map<int, std::string> m_watch_directories;
+#else
+        std::unordered_map<std::string, std::filesystem::file_time_type> m_write_times;
+#endif
+    };
+} // namespace hyper_platform
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "hyper_platform/key_codes.hpp"
 
 namespace hyper_platform
@@ -13,22 +15,26 @@ namespace hyper_platform
     class KeyPressedEvent
     {
     public:
-        explicit KeyPressedEvent(KeyCode key_code);
+        explicit KeyPressedEvent(KeyCode key_code, std::chrono::steady_clock::time_point timestamp);
 
         [[nodiscard]] KeyCode key_code() const;
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
 
     private:
         KeyCode m_key_code;
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 
     class KeyReleasedEvent
     {
     public:
-        explicit KeyReleasedEvent(KeyCode key_code);
+        explicit KeyReleasedEvent(KeyCode key_code, std::chrono::steady_clock::time_point timestamp);
 
         [[nodiscard]] KeyCode key_code() const;
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
 
     private:
         KeyCode m_key_code;
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 } // namespace hyper_platform
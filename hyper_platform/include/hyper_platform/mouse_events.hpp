@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "hyper_platform/mouse_codes.hpp"
 
 namespace hyper_platform
@@ -13,48 +15,56 @@ namespace hyper_platform
     class MouseMovedEvent
     {
     public:
-        MouseMovedEvent(float x, float y);
+        MouseMovedEvent(float x, float y, std::chrono::steady_clock::time_point timestamp);
 
         [[nodiscard]] float x() const;
         [[nodiscard]] float y() const;
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
 
     private:
         float m_x;
         float m_y;
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 
     class MouseScrolledEvent
     {
     public:
-        MouseScrolledEvent(float delta_x, float delta_y);
+        MouseScrolledEvent(float delta_x, float delta_y, std::chrono::steady_clock::time_point timestamp);
 
         [[nodiscard]] float delta_x() const;
         [[nodiscard]] float delta_y() const;
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
 
     private:
         float m_delta_x;
         float m_delta_y;
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 
     class MouseButtonPressedEvent
     {
     public:
-        explicit MouseButtonPressedEvent(MouseCode mouse_code);
+        explicit MouseButtonPressedEvent(MouseCode mouse_code, std::chrono::steady_clock::time_point timestamp);
 
         [[nodiscard]] MouseCode mouse_code() const;
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
 
     private:
         MouseCode m_mouse_code;
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 
     class MouseButtonReleasedEvent
     {
     public:
-        explicit MouseButtonReleasedEvent(MouseCode mouse_code);
+        explicit MouseButtonReleasedEvent(MouseCode mouse_code, std::chrono::steady_clock::time_point timestamp);
 
         [[nodiscard]] MouseCode mouse_code() const;
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
 
     private:
         MouseCode m_mouse_code;
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 } // namespace hyper_platform
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <variant>
+
+#include <hyper_core/spsc_queue.hpp>
+
+#include "hyper_platform/key_events.hpp"
+#include "hyper_platform/mouse_events.hpp"
+#include "hyper_platform/window_events.hpp"
+
+namespace hyper_platform
+{
+    using PlatformEvent = std::variant<
+        WindowCloseEvent,
+        WindowResizeEvent,
+        WindowFramebufferResizeEvent,
+        KeyPressedEvent,
+        KeyReleasedEvent,
+        MouseMovedEvent,
+        MouseScrolledEvent,
+        MouseButtonPressedEvent,
+        MouseButtonReleasedEvent>;
+
+    using PlatformEventQueue = hyper_core::SpscQueue<PlatformEvent>;
+} // namespace hyper_platform
@@ -10,6 +10,8 @@
 
 #include <hyper_event/event_bus.hpp>
 
+#include "hyper_platform/platform_events.hpp"
+
 struct GLFWwindow;
 
 namespace hyper_platform
@@ -20,10 +22,14 @@ namespace hyper_platform
         uint32_t width;
         uint32_t height;
         hyper_event::EventBus &event_bus;
+        bool queue_events = false;
     };
 
     class Window
     {
+    private:
+        static constexpr size_t s_event_queue_capacity = 4096;
+
     public:
         explicit Window(const WindowDescriptor &descriptor);
         ~Window();
@@ -32,9 +38,20 @@ namespace hyper_platform
         [[nodiscard]] uint32_t height() const;
         [[nodiscard]] GLFWwindow *native_window() const;
 
+        void dispatch_events();
+
         static void poll_events();
+        static void wait_events();
+        static void post_empty_event();
+
+    private:
+        void emit_event(const PlatformEvent &event);
 
     private:
         GLFWwindow *m_native_window;
+        hyper_event::EventBus &m_event_bus;
+
+        bool m_queue_events;
+        PlatformEventQueue m_event_queue;
     };
 } // namespace hyper_platform
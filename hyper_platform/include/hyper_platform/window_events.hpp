@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 
 namespace hyper_platform
@@ -13,32 +14,42 @@ namespace hyper_platform
     class WindowCloseEvent
     {
     public:
-        WindowCloseEvent() = default;
+        // NOTE: Default constructible, the platform event queue preallocates its slots
+        explicit WindowCloseEvent(std::chrono::steady_clock::time_point timestamp = {});
+
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
+
+    private:
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 
     class WindowResizeEvent
     {
     public:
-        WindowResizeEvent(uint32_t width, uint32_t height);
+        WindowResizeEvent(uint32_t width, uint32_t height, std::chrono::steady_clock::time_point timestamp);
 
         [[nodiscard]] uint32_t width() const;
         [[nodiscard]] uint32_t height() const;
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
 
     private:
         uint32_t m_width;
         uint32_t m_height;
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 
     class WindowFramebufferResizeEvent
     {
     public:
-        WindowFramebufferResizeEvent(uint32_t width, uint32_t height);
+        WindowFramebufferResizeEvent(uint32_t width, uint32_t height, std::chrono::steady_clock::time_point timestamp);
 
         uint32_t width() const;
         uint32_t height() const;
+        [[nodiscard]] std::chrono::steady_clock::time_point timestamp() const;
 
     private:
         uint32_t m_width;
         uint32_t m_height;
+        std::chrono::steady_clock::time_point m_timestamp;
     };
 } // namespace hyper_platform
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_platform/file_watcher.hpp"
+
+#include <algorithm>
+#include <array>
+
+#if HE_LINUX
+#    include <cerrno>
+#    include <cstring>
+
+#    include <sys/inotify.h>
+#    include <unistd.h>
+#endif
+
+#include <hyper_core/logger.hpp>
+
+namespace hyper_platform
+{
+    FileWatcher::FileWatcher(const FileWatcherDescriptor &descriptor)
+        : m_directory(descriptor.directory)
+#if HE_LINUX
+        , m_file_descriptor(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+        , m_watch_directories()
+#else
+        , m_write_times()
+#endif
+    {
+#if HE_LINUX
+        if (m_file_descriptor == -1)
+        {
+            HE_ERROR("Failed to initialize inotify: {}", std::strerror(errno));
+            return;
+        }
+#endif
+
+        this->add_watch(m_directory);
+
+        std::error_code error_code;
+        for (const std::filesystem::directory_entry &entry : std::filesystem::recursive_directory_iterator(m_directory, error_code))
+        {
+            if (entry.is_directory())
+            {
+                this->add_watch(entry.path().generic_string());
+            }
+        }
+
+        HE_INFO("Watching '{}' for file changes", m_directory);
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+#if HE_LINUX
+        if (m_file_descriptor != -1)
+        {
+            close(m_file_descriptor);
+        }
+#endif
+    }
+
+    std::vector<std::string> FileWatcher::poll()
+    {
+        std::vector<std::string> changed_files;
+
+#if HE_LINUX
+        if (m_file_descriptor == -1)
+        {
+            return changed_files;
+        }
+
+        alignas(inotify_event) std::array<char, 4096> buffer = {};
+        while (true)
+        {
+            const ssize_t length = read(m_file_descriptor, buffer.data(), buffer.size());
+            if (length <= 0)
+            {
+                break;
+            }
+
+            for (ssize_t offset = 0; offset < length;)
+            {
+                const inotify_event *event = reinterpret_cast<const inotify_event *>(buffer.data() + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                if (event->len == 0 || (event->mask & IN_ISDIR) != 0)
+                {
+                    continue;
+                }
+
+                const auto directory = m_watch_directories.find(event->wd);
+                if (directory == m_watch_directories.end())
+                {
+                    continue;
+                }
+
+                const std::string file_path = (std::filesystem::path(directory->second) / event->name).generic_string();
+                if (std::find(changed_files.begin(), changed_files.end(), file_path) == changed_files.end())
+                {
+                    changed_files.push_back(file_path);
+                }
+            }
+        }
+#else
+        std::error_code error_code;
+        for (const std::filesystem::directory_entry &entry : std::filesystem::recursive_directory_iterator(m_directory, error_code))
+        {
+            if (!entry.is_regular_file())
+            {
+                continue;
+            }
+
+            const std::string file_path = entry.path().generic_string();
+            const std::filesystem::file_time_type write_time = entry.last_write_time(error_code);
+
+            const auto [iterator, inserted] = m_write_times.try_emplace(file_path, write_time);
+            if (!inserted && iterator->second != write_time)
+            {
+                iterator->second = write_time;
+                changed_files.push_back(file_path);
+            }
+        }
+#endif
+
+        return changed_files;
+    }
+
+    void FileWatcher::add_watch(const std::string &directory)
+    {
+#if HE_LINUX
+        // NOTE: Editors commonly save through a rename, which only shows up as IN_MOVED_TO
+        const int watch_descriptor = inotify_add_watch(m_file_descriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watch_descriptor == -1)
+        {
+            HE_WARN("Failed to watch '{}': {}", directory, std::strerror(errno));
+            return;
+        }
+
+        m_watch_directories[watch_descriptor] = directory;
+#else
+        std::error_code error_code;
+        for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(directory, error_code))
+        {
+            if (entry.is_regular_file())
+            {
+                m_write_times[entry.path().generic_string()] = entry.last_write_time(error_code);
+            }
+        }
+#endif
+    }
+} // namespace hyper_platform
@@ -8,8 +8,9 @@
 
 namespace hyper_platform
 {
-    KeyPressedEvent::KeyPressedEvent(const KeyCode key_code)
+    KeyPressedEvent::KeyPressedEvent(const KeyCode key_code, const std::chrono::steady_clock::time_point timestamp)
         : m_key_code(key_code)
+        , m_timestamp(timestamp)
     {
     }
 
@@ -18,8 +19,14 @@ namespace hyper_platform
         return m_key_code;
     }
 
-    KeyReleasedEvent::KeyReleasedEvent(const KeyCode key_code)
+    std::chrono::steady_clock::time_point KeyPressedEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
+
+    KeyReleasedEvent::KeyReleasedEvent(const KeyCode key_code, const std::chrono::steady_clock::time_point timestamp)
         : m_key_code(key_code)
+        , m_timestamp(timestamp)
     {
     }
 
@@ -27,4 +34,9 @@ namespace hyper_platform
     {
         return m_key_code;
     }
+
+    std::chrono::steady_clock::time_point KeyReleasedEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
 } // namespace hyper_platform
@@ -8,9 +8,10 @@
 
 namespace hyper_platform
 {
-    MouseMovedEvent::MouseMovedEvent(const float x, const float y)
+    MouseMovedEvent::MouseMovedEvent(const float x, const float y, const std::chrono::steady_clock::time_point timestamp)
         : m_x(x)
         , m_y(y)
+        , m_timestamp(timestamp)
     {
     }
 
@@ -24,9 +25,15 @@ namespace hyper_platform
         return m_y;
     }
 
-    MouseScrolledEvent::MouseScrolledEvent(const float delta_x, const float delta_y)
+    std::chrono::steady_clock::time_point MouseMovedEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
+
+    MouseScrolledEvent::MouseScrolledEvent(const float delta_x, const float delta_y, const std::chrono::steady_clock::time_point timestamp)
         : m_delta_x(delta_x)
         , m_delta_y(delta_y)
+        , m_timestamp(timestamp)
     {
     }
 
@@ -40,8 +47,14 @@ namespace hyper_platform
         return m_delta_y;
     }
 
-    MouseButtonPressedEvent::MouseButtonPressedEvent(const MouseCode mouse_code)
+    std::chrono::steady_clock::time_point MouseScrolledEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
+
+    MouseButtonPressedEvent::MouseButtonPressedEvent(const MouseCode mouse_code, const std::chrono::steady_clock::time_point timestamp)
         : m_mouse_code(mouse_code)
+        , m_timestamp(timestamp)
     {
     }
 
@@ -50,8 +63,14 @@ namespace hyper_platform
         return m_mouse_code;
     }
 
-    MouseButtonReleasedEvent::MouseButtonReleasedEvent(const MouseCode mouse_code)
+    std::chrono::steady_clock::time_point MouseButtonPressedEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
+
+    MouseButtonReleasedEvent::MouseButtonReleasedEvent(const MouseCode mouse_code, const std::chrono::steady_clock::time_point timestamp)
         : m_mouse_code(mouse_code)
+        , m_timestamp(timestamp)
     {
     }
 
@@ -59,4 +78,9 @@ namespace hyper_platform
     {
         return m_mouse_code;
     }
+
+    std::chrono::steady_clock::time_point MouseButtonReleasedEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
 } // namespace hyper_platform
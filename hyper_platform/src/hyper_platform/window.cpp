@@ -6,6 +6,8 @@
 
 #include "hyper_platform/window.hpp"
 
+#include <chrono>
+
 #include <GLFW/glfw3.h>
 
 #include <hyper_core/assertion.hpp>
@@ -19,6 +21,9 @@ namespace hyper_platform
 {
     Window::Window(const WindowDescriptor &descriptor)
         : m_native_window(nullptr)
+        , m_event_bus(descriptor.event_bus)
+        , m_queue_events(descriptor.queue_events)
+        , m_event_queue(s_event_queue_capacity)
     {
         glfwInit();
         glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
@@ -27,45 +32,51 @@ namespace hyper_platform
             glfwCreateWindow(static_cast<int>(descriptor.width), static_cast<int>(descriptor.height), descriptor.title.data(), nullptr, nullptr);
         HE_ASSERT(m_native_window);
 
-        glfwSetWindowUserPointer(m_native_window, &descriptor.event_bus);
+        glfwSetWindowUserPointer(m_native_window, this);
 
         glfwSetWindowSizeCallback(
             m_native_window,
             [](GLFWwindow *window, const int width, const int height)
             {
-                hyper_event::EventBus &event_bus = *static_cast<hyper_event::EventBus *>(glfwGetWindowUserPointer(window));
-                event_bus.dispatch(hyper_platform::WindowResizeEvent(static_cast<uint32_t>(width), static_cast<uint32_t>(height)));
+                Window &self = *static_cast<Window *>(glfwGetWindowUserPointer(window));
+                self.emit_event(hyper_platform::WindowResizeEvent(
+                    static_cast<uint32_t>(width),
+                    static_cast<uint32_t>(height),
+                    std::chrono::steady_clock::now()));
             });
 
         glfwSetFramebufferSizeCallback(
             m_native_window,
             [](GLFWwindow *window, const int width, const int height)
             {
-                hyper_event::EventBus &event_bus = *static_cast<hyper_event::EventBus *>(glfwGetWindowUserPointer(window));
-                event_bus.dispatch(hyper_platform::WindowFramebufferResizeEvent(static_cast<uint32_t>(width), static_cast<uint32_t>(height)));
+                Window &self = *static_cast<Window *>(glfwGetWindowUserPointer(window));
+                self.emit_event(hyper_platform::WindowFramebufferResizeEvent(
+                    static_cast<uint32_t>(width),
+                    static_cast<uint32_t>(height),
+                    std::chrono::steady_clock::now()));
             });
 
         glfwSetWindowCloseCallback(
             m_native_window,
             [](GLFWwindow *window)
             {
-                hyper_event::EventBus &event_bus = *static_cast<hyper_event::EventBus *>(glfwGetWindowUserPointer(window));
-                event_bus.dispatch(hyper_platform::WindowCloseEvent());
+                Window &self = *static_cast<Window *>(glfwGetWindowUserPointer(window));
+                self.emit_event(hyper_platform::WindowCloseEvent(std::chrono::steady_clock::now()));
             });
 
         glfwSetKeyCallback(
             m_native_window,
             [](GLFWwindow *window, const int key, const int, const int action, const int)
             {
-                hyper_event::EventBus &event_bus = *static_cast<hyper_event::EventBus *>(glfwGetWindowUserPointer(window));
+                Window &self = *static_cast<Window *>(glfwGetWindowUserPointer(window));
 
                 switch (action)
                 {
                 case GLFW_PRESS:
-                    event_bus.dispatch(hyper_platform::KeyPressedEvent(static_cast<KeyCode>(key)));
+                    self.emit_event(hyper_platform::KeyPressedEvent(static_cast<KeyCode>(key), std::chrono::steady_clock::now()));
                     break;
                 case GLFW_RELEASE:
-                    event_bus.dispatch(hyper_platform::KeyReleasedEvent(static_cast<KeyCode>(key)));
+                    self.emit_event(hyper_platform::KeyReleasedEvent(static_cast<KeyCode>(key), std::chrono::steady_clock::now()));
                     break;
                 default:
                     break;
@@ -76,15 +87,15 @@ namespace hyper_platform
             m_native_window,
             [](GLFWwindow *window, const int button, const int action, const int)
             {
-                hyper_event::EventBus &event_bus = *static_cast<hyper_event::EventBus *>(glfwGetWindowUserPointer(window));
+                Window &self = *static_cast<Window *>(glfwGetWindowUserPointer(window));
 
                 switch (action)
                 {
                 case GLFW_PRESS:
-                    event_bus.dispatch(hyper_platform::MouseButtonPressedEvent(static_cast<MouseCode>(button)));
+                    self.emit_event(hyper_platform::MouseButtonPressedEvent(static_cast<MouseCode>(button), std::chrono::steady_clock::now()));
                     break;
                 case GLFW_RELEASE:
-                    event_bus.dispatch(hyper_platform::MouseButtonReleasedEvent(static_cast<MouseCode>(button)));
+                    self.emit_event(hyper_platform::MouseButtonReleasedEvent(static_cast<MouseCode>(button), std::chrono::steady_clock::now()));
                     break;
                 default:
                     break;
@@ -95,16 +106,19 @@ namespace hyper_platform
             m_native_window,
             [](GLFWwindow *window, const double delta_x, const double delta_y)
             {
-                hyper_event::EventBus &event_bus = *static_cast<hyper_event::EventBus *>(glfwGetWindowUserPointer(window));
-                event_bus.dispatch(hyper_platform::MouseScrolledEvent(static_cast<float>(delta_x), static_cast<float>(delta_y)));
+                Window &self = *static_cast<Window *>(glfwGetWindowUserPointer(window));
+                self.emit_event(hyper_platform::MouseScrolledEvent(
+                    static_cast<float>(delta_x),
+                    static_cast<float>(delta_y),
+                    std::chrono::steady_clock::now()));
             });
 
         glfwSetCursorPosCallback(
             m_native_window,
             [](GLFWwindow *window, const double x, const double y)
             {
-                hyper_event::EventBus &event_bus = *static_cast<hyper_event::EventBus *>(glfwGetWindowUserPointer(window));
-                event_bus.dispatch(hyper_platform::MouseMovedEvent(static_cast<float>(x), static_cast<float>(y)));
+                Window &self = *static_cast<Window *>(glfwGetWindowUserPointer(window));
+                self.emit_event(hyper_platform::MouseMovedEvent(static_cast<float>(x), static_cast<float>(y), std::chrono::steady_clock::now()));
             });
 
         HE_DEBUG("Created Window with title '{}' and size {}x{}", descriptor.title, descriptor.width, descriptor.height);
@@ -137,8 +151,50 @@ namespace hyper_platform
         return m_native_window;
     }
 
+    void Window::dispatch_events()
+    {
+        while (const std::optional<PlatformEvent> event = m_event_queue.pop())
+        {
+            std::visit(
+                [this](const auto &platform_event)
+                {
+                    m_event_bus.dispatch(platform_event);
+                },
+                *event);
+        }
+    }
+
     void Window::poll_events()
     {
         glfwPollEvents();
     }
+
+    void Window::wait_events()
+    {
+        glfwWaitEvents();
+    }
+
+    void Window::post_empty_event()
+    {
+        glfwPostEmptyEvent();
+    }
+
+    void Window::emit_event(const PlatformEvent &event)
+    {
+        if (!m_queue_events)
+        {
+            std::visit(
+                [this](const auto &platform_event)
+                {
+                    m_event_bus.dispatch(platform_event);
+                },
+                event);
+            return;
+        }
+
+        if (!m_event_queue.push(event))
+        {
+            HE_WARN("Platform event queue is full, dropping event with index {}", event.index());
+        }
+    }
 } // namespace hyper_platform
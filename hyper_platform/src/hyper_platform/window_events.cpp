@@ -8,9 +8,20 @@
 
 namespace hyper_platform
 {
-    WindowResizeEvent::WindowResizeEvent(const uint32_t width, const uint32_t height)
+    WindowCloseEvent::WindowCloseEvent(const std::chrono::steady_clock::time_point timestamp)
+        : m_timestamp(timestamp)
+    {
+    }
+
+    std::chrono::steady_clock::time_point WindowCloseEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
+
+    WindowResizeEvent::WindowResizeEvent(const uint32_t width, const uint32_t height, const std::chrono::steady_clock::time_point timestamp)
         : m_width(width)
         , m_height((height))
+        , m_timestamp(timestamp)
     {
     }
 
@@ -24,9 +35,18 @@ namespace hyper_platform
         return m_height;
     }
 
-    WindowFramebufferResizeEvent::WindowFramebufferResizeEvent(const uint32_t width, const uint32_t height)
+    std::chrono::steady_clock::time_point WindowResizeEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
+
+    WindowFramebufferResizeEvent::WindowFramebufferResizeEvent(
+        const uint32_t width,
+        const uint32_t height,
+        const std::chrono::steady_clock::time_point timestamp)
         : m_width(width)
         , m_height((height))
+        , m_timestamp(timestamp)
     {
     }
 
@@ -39,4 +59,9 @@ namespace hyper_platform
     {
         return m_height;
     }
+
+    std::chrono::steady_clock::time_point WindowFramebufferResizeEvent::timestamp() const
+    {
+        return m_timestamp;
+    }
 } // namespace hyper_platform
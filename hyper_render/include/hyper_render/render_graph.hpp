@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <hyper_rhi/command_list.hpp>
+#include <hyper_rhi/graphics_device.hpp>
+
+namespace hyper_render
+{
+    struct RenderGraphTexture
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+    };
+
+    struct RenderGraphBuffer
+    {
+        uint32_t index = std::numeric_limits<uint32_t>::max();
+    };
+
+    struct RenderGraphDescriptor
+    {
+        hyper_rhi::GraphicsDeviceHandle graphics_device;
+    };
+
+    struct RenderGraphStatistics
+    {
+        uint32_t pass_count = 0;
+        uint32_t culled_pass_count = 0;
+        uint32_t barrier_count = 0;
+        uint32_t barrier_batch_count = 0;
+
+        // NOTE: Transient bytes are the sum of all transient resources, heap bytes what is left after aliasing
+        uint64_t transient_byte_size = 0;
+        uint64_t heap_byte_size = 0;
+    };
+
+    class RenderGraph;
+
+    using RenderGraphExecuteCallback = std::function<void(const RenderGraph &render_graph, hyper_rhi::CommandList &command_list)>;
+
+    class RenderGraphPassBuilder
+    {
+    public:
+        RenderGraphPassBuilder(RenderGraph &render_graph, uint32_t pass);
+
+        RenderGraphPassBuilder &read(RenderGraphTexture texture, hyper_rhi::ResourceState state);
+        RenderGraphPassBuilder &read(RenderGraphBuffer buffer, hyper_rhi::ResourceState state);
+        RenderGraphPassBuilder &write(RenderGraphTexture texture, hyper_rhi::ResourceState state);
+        RenderGraphPassBuilder &write(RenderGraphBuffer buffer, hyper_rhi::ResourceState state);
+
+        // NOTE: Passes with side effects are never culled, even if none of their outputs are used
+        RenderGraphPassBuilder &side_effect();
+
+        void execute(RenderGraphExecuteCallback callback);
+
+    private:
+        RenderGraph &m_render_graph;
+        uint32_t m_pass;
+    };
+
+    class RenderGraph
+    {
+    private:
+        enum class ResourceType
+        {
+            Buffer,
+            Texture,
+        };
+
+        struct Resource
+        {
+            std::string label;
+            ResourceType type;
+
+            hyper_rhi::BufferDescriptor buffer_descriptor;
+            hyper_rhi::TextureDescriptor texture_descriptor;
+            hyper_rhi::BufferHandle buffer;
+            hyper_rhi::TextureHandle texture;
+
+            // NOTE: Imported resources outlive the graph and are never culled or aliased
+            bool imported;
+            hyper_rhi::ResourceState initial_state;
+            hyper_rhi::ResourceState final_state;
+
+            std::vector<uint32_t> producers;
+            uint32_t reference_count;
+
+            uint32_t first_pass;
+            uint32_t last_pass;
+            hyper_rhi::MemoryRequirements memory_requirements;
+            uint64_t memory_heap_offset;
+            bool aliased;
+        };
+
+        struct Access
+        {
+            uint32_t resource;
+            hyper_rhi::ResourceState state;
+            bool write;
+        };
+
+        struct Pass
+        {
+            std::string label;
+            std::vector<Access> accesses;
+            RenderGraphExecuteCallback callback;
+            bool side_effect;
+
+            uint32_t reference_count;
+            bool culled;
+
+            std::vector<hyper_rhi::BufferBarrier> buffer_barriers;
+            std::vector<hyper_rhi::TextureBarrier> texture_barriers;
+        };
+
+        struct TransientBuffer
+        {
+            hyper_rhi::BufferDescriptor descriptor;
+            hyper_rhi::BufferHandle buffer;
+        };
+
+        struct TransientTexture
+        {
+            hyper_rhi::TextureDescriptor descriptor;
+            hyper_rhi::TextureHandle texture;
+        };
+
+        // NOTE: Placed resources are kept with their heap and reused while a later frame asks for the same descriptor
+        struct TransientHeap
+        {
+            hyper_rhi::MemoryHeapHandle memory_heap;
+            hyper_rhi::MemoryRequirements requirements;
+
+            std::vector<TransientBuffer> buffers;
+            std::vector<TransientTexture> textures;
+        };
+
+    public:
+        explicit RenderGraph(const RenderGraphDescriptor &descriptor);
+
+        // NOTE: Clears the passes and resources of the previous frame, transient memory is kept per frame slot
+        void begin_frame(uint32_t frame_index);
+
+        [[nodiscard]] RenderGraphTexture import_texture(
+            const std::string &label,
+            hyper_rhi::TextureHandle texture,
+            hyper_rhi::ResourceState initial_state,
+            hyper_rhi::ResourceState final_state);
+        [[nodiscard]] RenderGraphBuffer import_buffer(
+            const std::string &label,
+            hyper_rhi::BufferHandle buffer,
+            hyper_rhi::ResourceState initial_state,
+            hyper_rhi::ResourceState final_state);
+
+        [[nodiscard]] RenderGraphTexture create_texture(const hyper_rhi::TextureDescriptor &descriptor);
+        [[nodiscard]] RenderGraphBuffer create_buffer(const hyper_rhi::BufferDescriptor &descriptor);
+
+        [[nodiscard]] RenderGraphPassBuilder add_pass(const std::string &label);
+
+        void compile();
+        void execute(hyper_rhi::CommandList &command_list) const;
+
+        [[nodiscard]] const hyper_rhi::TextureHandle &texture(RenderGraphTexture texture) const;
+        [[nodiscard]] const hyper_rhi::BufferHandle &buffer(RenderGraphBuffer buffer) const;
+
+        [[nodiscard]] const RenderGraphStatistics &statistics() const;
+
+    private:
+        friend class RenderGraphPassBuilder;
+
+        void add_access(uint32_t pass, uint32_t resource, hyper_rhi::ResourceState state, bool write);
+
+        void cull_passes();
+        void compute_lifetimes();
+        void allocate_transient_resources();
+        void compute_barriers();
+
+    private:
+        hyper_rhi::GraphicsDeviceHandle m_graphics_device;
+
+        std::vector<Resource> m_resources;
+        std::vector<Pass> m_passes;
+
+        std::vector<hyper_rhi::BufferBarrier> m_final_buffer_barriers;
+        std::vector<hyper_rhi::TextureBarrier> m_final_texture_barriers;
+
+        std::array<TransientHeap, hyper_rhi::GraphicsDevice::s_max_frame_count> m_transient_heaps;
+        uint32_t m_frame_slot;
+
+        RenderGraphStatistics m_statistics;
+    };
+} // namespace hyper_render
@@ -6,38 +6,66 @@
 
 #pragma once
 
+#include <chrono>
+
+#include <hyper_core/thread_pool.hpp>
+#include <hyper_rhi/frame_allocator.hpp>
 #include <hyper_rhi/graphics_device.hpp>
 #include <hyper_rhi/surface.hpp>
 
+#include "hyper_render/render_graph.hpp"
+#include "hyper_render/shader_library.hpp"
+
 namespace hyper_render
 {
     struct RendererDescriptor
     {
         hyper_rhi::GraphicsDeviceHandle graphics_device;
         hyper_rhi::SurfaceHandle surface;
+        hyper_core::ThreadPool *thread_pool = nullptr;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        bool hot_reload = false;
+        // NOTE: Reads mesh data through 64-bit buffer addresses instead of storage buffer descriptors when the device supports it
+        bool buffer_device_address = false;
     };
 
     class Renderer
     {
     public:
         explicit Renderer(const RendererDescriptor &descriptor);
+        ~Renderer();
 
+        void wait_for_frame() const;
+        void resize(uint32_t width, uint32_t height);
         void render();
 
+    private:
+        [[nodiscard]] uint64_t buffer_reference(const hyper_rhi::BufferHandle &buffer) const;
+
     private:
         hyper_rhi::GraphicsDeviceHandle m_graphics_device;
         hyper_rhi::SurfaceHandle m_surface;
+        uint32_t m_width;
+        uint32_t m_height;
+        bool m_buffer_device_address;
+        ShaderLibrary m_shader_library;
+        RenderGraph m_render_graph;
         hyper_rhi::CommandListHandle m_command_list;
+        hyper_rhi::FrameAllocator m_frame_allocator;
         hyper_rhi::PipelineLayoutHandle m_pipeline_layout;
-        hyper_rhi::ShaderModuleHandle m_vertex_shader;
-        hyper_rhi::ShaderModuleHandle m_fragment_shader;
-        hyper_rhi::GraphicsPipelineHandle m_pipeline;
+        uint32_t m_opaque_pipeline;
         hyper_rhi::BufferHandle m_material_buffer;
         hyper_rhi::BufferHandle m_positions_buffer;
         hyper_rhi::BufferHandle m_normals_buffer;
         hyper_rhi::BufferHandle m_mesh_buffer;
         hyper_rhi::BufferHandle m_indices_buffer;
+        hyper_rhi::BufferHandle m_argument_buffer;
+        hyper_rhi::BufferHandle m_count_buffer;
+        uint32_t m_object_count;
 
+        std::chrono::steady_clock::time_point m_start_time;
+        std::chrono::steady_clock::time_point m_last_frame_time;
         uint32_t m_frame_index;
     };
 } // namespace hyper_render
\ No newline at end of file
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <hyper_core/thread_pool.hpp>
+#include <hyper_platform/file_watcher.hpp>
+#include <hyper_rhi/graphics_device.hpp>
+#include <hyper_rhi/shader_compiler.hpp>
+
+namespace hyper_render
+{
+    struct ShaderLibraryDescriptor
+    {
+        hyper_rhi::GraphicsDeviceHandle graphics_device;
+        hyper_core::ThreadPool *thread_pool = nullptr;
+        std::string shader_directory = "./assets/shaders";
+        std::string cache_directory = "./shader_cache";
+        std::vector<std::string> defines;
+        bool hot_reload = false;
+    };
+
+    struct ShaderDescriptor
+    {
+        std::string label;
+
+        hyper_rhi::ShaderType type = hyper_rhi::ShaderType::None;
+        std::string file_path;
+        std::string entry_name = "main";
+    };
+
+    class ShaderLibrary
+    {
+    private:
+        struct Shader
+        {
+            ShaderDescriptor descriptor;
+            hyper_rhi::ShaderModuleHandle shader_module;
+            std::vector<std::string> dependencies;
+
+            // NOTE: Compilations can finish out of order, only a result newer than the installed one is swapped in
+            uint64_t latest_generation;
+            uint64_t installed_generation;
+        };
+
+        struct GraphicsPipeline
+        {
+            hyper_rhi::GraphicsPipelineDescriptor descriptor;
+            uint32_t vertex_shader;
+            uint32_t fragment_shader;
+            hyper_rhi::GraphicsPipelineHandle pipeline;
+
+            uint64_t latest_generation;
+            uint64_t installed_generation;
+        };
+
+        struct PendingCompilation
+        {
+            uint32_t shader;
+            uint64_t generation;
+            std::future<std::optional<hyper_rhi::ShaderCompilationResult>> result;
+        };
+
+        struct PendingPipeline
+        {
+            uint32_t graphics_pipeline;
+            uint64_t generation;
+            std::shared_future<hyper_rhi::GraphicsPipelineHandle> pipeline;
+        };
+
+    public:
+        explicit ShaderLibrary(const ShaderLibraryDescriptor &descriptor);
+        ~ShaderLibrary();
+
+        [[nodiscard]] uint32_t add_graphics_pipeline(
+            const hyper_rhi::GraphicsPipelineDescriptor &descriptor,
+            const ShaderDescriptor &vertex_shader,
+            const ShaderDescriptor &fragment_shader);
+
+        // NOTE: Returns an empty handle while one of the pipeline's shaders fails to compile
+        [[nodiscard]] const hyper_rhi::GraphicsPipelineHandle &graphics_pipeline(uint32_t graphics_pipeline) const;
+
+        // NOTE: Must be called at a frame boundary, finished pipelines are swapped in here
+        void update();
+
+    private:
+        [[nodiscard]] uint32_t load_shader(const ShaderDescriptor &descriptor);
+
+        [[nodiscard]] hyper_rhi::ShaderCompilationDescriptor compilation_descriptor(const ShaderDescriptor &descriptor) const;
+        [[nodiscard]] hyper_rhi::ShaderModuleHandle create_shader_module(
+            const ShaderDescriptor &descriptor,
+            std::vector<uint8_t> bytes) const;
+
+        void recompile_dependents(const std::string &file_path);
+        void collect_compilations();
+        void collect_pipelines();
+
+        void rebuild_dependency_graph();
+
+        [[nodiscard]] static std::string normalize_path(const std::string &file_path);
+
+    private:
+        hyper_rhi::GraphicsDeviceHandle m_graphics_device;
+        hyper_core::ThreadPool *m_thread_pool;
+        std::vector<std::string> m_defines;
+
+        hyper_rhi::ShaderCompiler m_shader_compiler;
+        std::unique_ptr<hyper_platform::FileWatcher> m_file_watcher;
+
+        std::vector<Shader> m_shaders;
+        std::vector<GraphicsPipeline> m_graphics_pipelines;
+
+        // NOTE: Maps every source and include file to the shaders that have to be recompiled when it changes
+        std::unordered_map<std::string, std::vector<uint32_t>> m_dependents;
+
+        std::vector<PendingCompilation> m_pending_compilations;
+        std::vector<PendingPipeline> m_pending_pipelines;
+    };
+} // namespace hyper_render
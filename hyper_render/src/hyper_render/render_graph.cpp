@@ -0,0 +1,742 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/render_graph.hpp"
+
+#include <algorithm>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/logger.hpp>
+#include <hyper_core/profiler.hpp>
+
+namespace hyper_render
+{
+    static constexpr uint32_t s_invalid_pass = std::numeric_limits<uint32_t>::max();
+
+    static bool is_write_state(const hyper_rhi::ResourceState state)
+    {
+        switch (state)
+        {
+        case hyper_rhi::ResourceState::ColorAttachment:
+        case hyper_rhi::ResourceState::DepthStencilAttachment:
+        case hyper_rhi::ResourceState::UnorderedAccess:
+        case hyper_rhi::ResourceState::TransferDestination:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static uint64_t align_up(const uint64_t value, const uint64_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    RenderGraphPassBuilder::RenderGraphPassBuilder(RenderGraph &render_graph, const uint32_t pass)
+        : m_render_graph(render_graph)
+        , m_pass(pass)
+    {
+    }
+
+    RenderGraphPassBuilder &RenderGraphPassBuilder::read(const RenderGraphTexture texture, const hyper_rhi::ResourceState state)
+    {
+        m_render_graph.add_access(m_pass, texture.index, state, false);
+        return *this;
+    }
+
+    RenderGraphPassBuilder &RenderGraphPassBuilder::read(const RenderGraphBuffer buffer, const hyper_rhi::ResourceState state)
+    {
+        m_render_graph.add_access(m_pass, buffer.index, state, false);
+        return *this;
+    }
+
+    RenderGraphPassBuilder &RenderGraphPassBuilder::write(const RenderGraphTexture texture, const hyper_rhi::ResourceState state)
+    {
+        HE_ASSERT(is_write_state(state));
+
+        m_render_graph.add_access(m_pass, texture.index, state, true);
+        return *this;
+    }
+
+    RenderGraphPassBuilder &RenderGraphPassBuilder::write(const RenderGraphBuffer buffer, const hyper_rhi::ResourceState state)
+    {
+        HE_ASSERT(is_write_state(state));
+
+        m_render_graph.add_access(m_pass, buffer.index, state, true);
+        return *this;
+    }
+
+    RenderGraphPassBuilder &RenderGraphPassBuilder::side_effect()
+    {
+        m_render_graph.m_passes[m_pass].side_effect = true;
+        return *this;
+    }
+
+    void RenderGraphPassBuilder::execute(RenderGraphExecuteCallback callback)
+    {
+        m_render_graph.m_passes[m_pass].callback = std::move(callback);
+    }
+
+    RenderGraph::RenderGraph(const RenderGraphDescriptor &descriptor)
+        : m_graphics_device(descriptor.graphics_device)
+        , m_resources()
+        , m_passes()
+        , m_final_buffer_barriers()
+        , m_final_texture_barriers()
+        , m_transient_heaps()
+        , m_frame_slot(0)
+        , m_statistics()
+    {
+    }
+
+    void RenderGraph::begin_frame(const uint32_t frame_index)
+    {
+        m_resources.clear();
+        m_passes.clear();
+        m_final_buffer_barriers.clear();
+        m_final_texture_barriers.clear();
+
+        // NOTE: Transient memory of a slot is only reused once the frame that last used it has finished
+        m_frame_slot = frame_index % m_graphics_device->frame_count();
+        m_statistics = {};
+    }
+
+    RenderGraphTexture RenderGraph::import_texture(
+        const std::string &label,
+        hyper_rhi::TextureHandle texture,
+        const hyper_rhi::ResourceState initial_state,
+        const hyper_rhi::ResourceState final_state)
+    {
+        HE_ASSERT(texture);
+
+        m_resources.push_back({
+            .label = label,
+            .type = ResourceType::Texture,
+            .buffer_descriptor = {},
+            .texture_descriptor = {},
+            .buffer = nullptr,
+            .texture = std::move(texture),
+            .imported = true,
+            .initial_state = initial_state,
+            .final_state = final_state,
+            .producers = {},
+            .reference_count = 0,
+            .first_pass = s_invalid_pass,
+            .last_pass = s_invalid_pass,
+            .memory_requirements = {},
+            .memory_heap_offset = 0,
+            .aliased = false,
+        });
+
+        return RenderGraphTexture{
+            .index = static_cast<uint32_t>(m_resources.size() - 1),
+        };
+    }
+
+    RenderGraphBuffer RenderGraph::import_buffer(
+        const std::string &label,
+        hyper_rhi::BufferHandle buffer,
+        const hyper_rhi::ResourceState initial_state,
+        const hyper_rhi::ResourceState final_state)
+    {
+        HE_ASSERT(buffer);
+
+        m_resources.push_back({
+            .label = label,
+            .type = ResourceType::Buffer,
+            .buffer_descriptor = {},
+            .texture_descriptor = {},
+            .buffer = std::move(buffer),
+            .texture = nullptr,
+            .imported = true,
+            .initial_state = initial_state,
+            .final_state = final_state,
+            .producers = {},
+            .reference_count = 0,
+            .first_pass = s_invalid_pass,
+            .last_pass = s_invalid_pass,
+            .memory_requirements = {},
+            .memory_heap_offset = 0,
+            .aliased = false,
+        });
+
+        return RenderGraphBuffer{
+            .index = static_cast<uint32_t>(m_resources.size() - 1),
+        };
+    }
+
+    RenderGraphTexture RenderGraph::create_texture(const hyper_rhi::TextureDescriptor &descriptor)
+    {
+        m_resources.push_back({
+            .label = descriptor.label,
+            .type = ResourceType::Texture,
+            .buffer_descriptor = {},
+            .texture_descriptor = descriptor,
+            .buffer = nullptr,
+            .texture = nullptr,
+            .imported = false,
+            .initial_state = hyper_rhi::ResourceState::Undefined,
+            .final_state = hyper_rhi::ResourceState::Undefined,
+            .producers = {},
+            .reference_count = 0,
+            .first_pass = s_invalid_pass,
+            .last_pass = s_invalid_pass,
+            .memory_requirements = {},
+            .memory_heap_offset = 0,
+            .aliased = false,
+        });
+
+        return RenderGraphTexture{
+            .index = static_cast<uint32_t>(m_resources.size() - 1),
+        };
+    }
+
+    RenderGraphBuffer RenderGraph::create_buffer(const hyper_rhi::BufferDescriptor &descriptor)
+    {
+        HE_ASSERT(descriptor.memory_location == hyper_rhi::MemoryLocation::GpuOnly);
+
+        m_resources.push_back({
+            .label = descriptor.label,
+            .type = ResourceType::Buffer,
+            .buffer_descriptor = descriptor,
+            .texture_descriptor = {},
+            .buffer = nullptr,
+            .texture = nullptr,
+            .imported = false,
+            .initial_state = hyper_rhi::ResourceState::Undefined,
+            .final_state = hyper_rhi::ResourceState::Undefined,
+            .producers = {},
+            .reference_count = 0,
+            .first_pass = s_invalid_pass,
+            .last_pass = s_invalid_pass,
+            .memory_requirements = {},
+            .memory_heap_offset = 0,
+            .aliased = false,
+        });
+
+        return RenderGraphBuffer{
+            .index = static_cast<uint32_t>(m_resources.size() - 1),
+        };
+    }
+
+    RenderGraphPassBuilder RenderGraph::add_pass(const std::string &label)
+    {
+        m_passes.push_back({
+            .label = label,
+            .accesses = {},
+            .callback = nullptr,
+            .side_effect = false,
+            .reference_count = 0,
+            .culled = false,
+            .buffer_barriers = {},
+            .texture_barriers = {},
+        });
+
+        return RenderGraphPassBuilder(*this, static_cast<uint32_t>(m_passes.size() - 1));
+    }
+
+    void RenderGraph::compile()
+    {
+        HE_PROFILE_SCOPE("Render Graph Compile");
+
+        this->cull_passes();
+        this->compute_lifetimes();
+        this->allocate_transient_resources();
+        this->compute_barriers();
+
+        HE_TRACE(
+            "Compiled render graph with {} passes ({} culled), {} barriers in {} batches and {} of {} transient bytes",
+            m_statistics.pass_count,
+            m_statistics.culled_pass_count,
+            m_statistics.barrier_count,
+            m_statistics.barrier_batch_count,
+            m_statistics.heap_byte_size,
+            m_statistics.transient_byte_size);
+    }
+
+    void RenderGraph::execute(hyper_rhi::CommandList &command_list) const
+    {
+        for (const Pass &pass : m_passes)
+        {
+            if (pass.culled)
+            {
+                continue;
+            }
+
+            command_list.begin_gpu_scope(pass.label);
+
+            if (!pass.buffer_barriers.empty() || !pass.texture_barriers.empty())
+            {
+                command_list.barrier(pass.buffer_barriers, pass.texture_barriers);
+            }
+
+            if (pass.callback)
+            {
+                pass.callback(*this, command_list);
+            }
+
+            command_list.end_gpu_scope();
+        }
+
+        if (!m_final_buffer_barriers.empty() || !m_final_texture_barriers.empty())
+        {
+            command_list.barrier(m_final_buffer_barriers, m_final_texture_barriers);
+        }
+    }
+
+    const hyper_rhi::TextureHandle &RenderGraph::texture(const RenderGraphTexture texture) const
+    {
+        HE_ASSERT(texture.index < m_resources.size());
+        HE_ASSERT(m_resources[texture.index].type == ResourceType::Texture);
+
+        return m_resources[texture.index].texture;
+    }
+
+    const hyper_rhi::BufferHandle &RenderGraph::buffer(const RenderGraphBuffer buffer) const
+    {
+        HE_ASSERT(buffer.index < m_resources.size());
+        HE_ASSERT(m_resources[buffer.index].type == ResourceType::Buffer);
+
+        return m_resources[buffer.index].buffer;
+    }
+
+    const RenderGraphStatistics &RenderGraph::statistics() const
+    {
+        return m_statistics;
+    }
+
+    void RenderGraph::add_access(const uint32_t pass, const uint32_t resource, const hyper_rhi::ResourceState state, const bool write)
+    {
+        HE_ASSERT(pass < m_passes.size());
+        HE_ASSERT(resource < m_resources.size());
+
+        std::vector<Access> &accesses = m_passes[pass].accesses;
+
+        // NOTE: A pass uses a resource in exactly one state, repeated declarations only widen it to a write
+        const auto access = std::find_if(
+            accesses.begin(),
+            accesses.end(),
+            [resource](const Access &other_access)
+            {
+                return other_access.resource == resource;
+            });
+        if (access != accesses.end())
+        {
+            HE_ASSERT(
+                access->state == state, "Resource '{}' is used in two states by pass '{}'", m_resources[resource].label, m_passes[pass].label);
+
+            access->write |= write;
+            return;
+        }
+
+        accesses.push_back({
+            .resource = resource,
+            .state = state,
+            .write = write,
+        });
+    }
+
+    void RenderGraph::cull_passes()
+    {
+        for (Resource &resource : m_resources)
+        {
+            resource.producers.clear();
+            resource.reference_count = resource.imported ? 1 : 0;
+        }
+
+        for (uint32_t pass_index = 0; pass_index < m_passes.size(); ++pass_index)
+        {
+            Pass &pass = m_passes[pass_index];
+            pass.reference_count = pass.side_effect ? 1 : 0;
+            pass.culled = false;
+
+            for (const Access &access : pass.accesses)
+            {
+                Resource &resource = m_resources[access.resource];
+                if (access.write)
+                {
+                    resource.producers.push_back(pass_index);
+                    ++pass.reference_count;
+                }
+                else
+                {
+                    ++resource.reference_count;
+                }
+            }
+        }
+
+        // NOTE: Collected before any pass is culled, afterwards a resource is pushed once when its last reader is culled
+        std::vector<uint32_t> unused_resources;
+        for (uint32_t resource_index = 0; resource_index < m_resources.size(); ++resource_index)
+        {
+            if (m_resources[resource_index].reference_count == 0)
+            {
+                unused_resources.push_back(resource_index);
+            }
+        }
+
+        const auto cull_pass = [this, &unused_resources](Pass &pass)
+        {
+            pass.culled = true;
+
+            for (const Access &access : pass.accesses)
+            {
+                Resource &resource = m_resources[access.resource];
+                if (!access.write && --resource.reference_count == 0)
+                {
+                    unused_resources.push_back(access.resource);
+                }
+            }
+        };
+
+        for (Pass &pass : m_passes)
+        {
+            if (pass.reference_count == 0)
+            {
+                cull_pass(pass);
+            }
+        }
+
+        // NOTE: Walks the graph backwards, a pass dies once none of the resources it writes are read
+        while (!unused_resources.empty())
+        {
+            const uint32_t resource_index = unused_resources.back();
+            unused_resources.pop_back();
+
+            for (const uint32_t producer : m_resources[resource_index].producers)
+            {
+                Pass &pass = m_passes[producer];
+                if (!pass.culled && --pass.reference_count == 0)
+                {
+                    cull_pass(pass);
+                }
+            }
+        }
+
+        m_statistics.pass_count = static_cast<uint32_t>(m_passes.size());
+        m_statistics.culled_pass_count = static_cast<uint32_t>(std::count_if(
+            m_passes.begin(),
+            m_passes.end(),
+            [](const Pass &pass)
+            {
+                return pass.culled;
+            }));
+    }
+
+    void RenderGraph::compute_lifetimes()
+    {
+        for (uint32_t pass_index = 0; pass_index < m_passes.size(); ++pass_index)
+        {
+            const Pass &pass = m_passes[pass_index];
+            if (pass.culled)
+            {
+                continue;
+            }
+
+            for (const Access &access : pass.accesses)
+            {
+                Resource &resource = m_resources[access.resource];
+                resource.first_pass = std::min(resource.first_pass, pass_index);
+                resource.last_pass = resource.last_pass == s_invalid_pass ? pass_index : std::max(resource.last_pass, pass_index);
+
+                if (resource.imported)
+                {
+                    continue;
+                }
+
+                // NOTE: Transient usage flags follow from how the passes access the resource
+                switch (access.state)
+                {
+                case hyper_rhi::ResourceState::ColorAttachment:
+                case hyper_rhi::ResourceState::DepthStencilAttachment:
+                case hyper_rhi::ResourceState::DepthStencilRead:
+                    resource.texture_descriptor.is_render_attachment = true;
+                    break;
+                case hyper_rhi::ResourceState::UnorderedAccess:
+                    resource.texture_descriptor.is_storage = true;
+                    break;
+                case hyper_rhi::ResourceState::ConstantBuffer:
+                    resource.buffer_descriptor.is_constant_buffer = true;
+                    break;
+                case hyper_rhi::ResourceState::IndexBuffer:
+                    resource.buffer_descriptor.is_index_buffer = true;
+                    break;
+                case hyper_rhi::ResourceState::IndirectArgument:
+                    resource.buffer_descriptor.is_argument_buffer = true;
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+    }
+
+    void RenderGraph::allocate_transient_resources()
+    {
+        std::vector<uint32_t> transient_resources;
+        for (uint32_t resource_index = 0; resource_index < m_resources.size(); ++resource_index)
+        {
+            Resource &resource = m_resources[resource_index];
+            if (resource.imported || resource.first_pass == s_invalid_pass)
+            {
+                continue;
+            }
+
+            resource.memory_requirements = resource.type == ResourceType::Texture
+                                               ? m_graphics_device->texture_memory_requirements(resource.texture_descriptor)
+                                               : m_graphics_device->buffer_memory_requirements(resource.buffer_descriptor);
+            m_statistics.transient_byte_size += resource.memory_requirements.byte_size;
+
+            transient_resources.push_back(resource_index);
+        }
+
+        if (transient_resources.empty())
+        {
+            return;
+        }
+
+        // NOTE: Placing the largest resources first keeps the packing tight
+        std::sort(
+            transient_resources.begin(),
+            transient_resources.end(),
+            [this](const uint32_t lhs, const uint32_t rhs)
+            {
+                return m_resources[lhs].memory_requirements.byte_size > m_resources[rhs].memory_requirements.byte_size;
+            });
+
+        hyper_rhi::MemoryRequirements heap_requirements = {
+            .byte_size = 0,
+            .alignment = 1,
+            .memory_types = ~0u,
+        };
+
+        std::vector<uint32_t> placed_resources;
+        placed_resources.reserve(transient_resources.size());
+        for (const uint32_t resource_index : transient_resources)
+        {
+            Resource &resource = m_resources[resource_index];
+            const hyper_rhi::MemoryRequirements &requirements = resource.memory_requirements;
+
+            // NOTE: Resources whose lifetimes overlap must not overlap in memory, everything else may alias
+            uint64_t offset = 0;
+            bool conflict = true;
+            while (conflict)
+            {
+                conflict = false;
+                for (const uint32_t placed_index : placed_resources)
+                {
+                    const Resource &placed_resource = m_resources[placed_index];
+
+                    const bool lifetimes_overlap =
+                        resource.first_pass <= placed_resource.last_pass && placed_resource.first_pass <= resource.last_pass;
+                    const bool memory_overlaps = offset < placed_resource.memory_heap_offset + placed_resource.memory_requirements.byte_size &&
+                                                 placed_resource.memory_heap_offset < offset + requirements.byte_size;
+                    if (lifetimes_overlap && memory_overlaps)
+                    {
+                        const uint64_t placed_end = placed_resource.memory_heap_offset + placed_resource.memory_requirements.byte_size;
+                        offset = align_up(placed_end, requirements.alignment);
+                        conflict = true;
+                    }
+                }
+            }
+
+            resource.memory_heap_offset = offset;
+            placed_resources.push_back(resource_index);
+
+            heap_requirements.byte_size = std::max(heap_requirements.byte_size, offset + requirements.byte_size);
+            heap_requirements.alignment = std::max(heap_requirements.alignment, requirements.alignment);
+            heap_requirements.memory_types &= requirements.memory_types;
+        }
+
+        HE_ASSERT(heap_requirements.memory_types != 0, "Transient resources do not share a common memory type");
+
+        for (const uint32_t resource_index : transient_resources)
+        {
+            Resource &resource = m_resources[resource_index];
+            for (const uint32_t other_index : transient_resources)
+            {
+                const Resource &other_resource = m_resources[other_index];
+
+                // NOTE: Only aliases of earlier resources need a barrier on first use, fresh memory has no previous user
+                const bool memory_overlaps =
+                    resource.memory_heap_offset < other_resource.memory_heap_offset + other_resource.memory_requirements.byte_size &&
+                    other_resource.memory_heap_offset < resource.memory_heap_offset + resource.memory_requirements.byte_size;
+                if (other_index != resource_index && memory_overlaps && other_resource.last_pass < resource.first_pass)
+                {
+                    resource.aliased = true;
+                    break;
+                }
+            }
+        }
+
+        TransientHeap &transient_heap = m_transient_heaps[m_frame_slot];
+        const bool heap_fits = transient_heap.memory_heap && transient_heap.requirements.byte_size >= heap_requirements.byte_size &&
+                               transient_heap.requirements.alignment >= heap_requirements.alignment &&
+                               (transient_heap.requirements.memory_types & heap_requirements.memory_types) ==
+                                   transient_heap.requirements.memory_types;
+        if (!heap_fits)
+        {
+            transient_heap.memory_heap = m_graphics_device->create_memory_heap({
+                .label = fmt::format("Render Graph Heap #{}", m_frame_slot),
+                .requirements = heap_requirements,
+            });
+            transient_heap.requirements = heap_requirements;
+            transient_heap.buffers.clear();
+            transient_heap.textures.clear();
+        }
+
+        m_statistics.heap_byte_size = heap_requirements.byte_size;
+
+        // NOTE: Cached resources that no pass of this frame asked for are dropped, their destruction is deferred by the device
+        std::vector<TransientBuffer> transient_buffers;
+        std::vector<TransientTexture> transient_textures;
+        for (const uint32_t resource_index : transient_resources)
+        {
+            Resource &resource = m_resources[resource_index];
+            if (resource.type == ResourceType::Texture)
+            {
+                hyper_rhi::TextureDescriptor texture_descriptor = resource.texture_descriptor;
+                texture_descriptor.memory_heap = transient_heap.memory_heap;
+                texture_descriptor.memory_heap_offset = resource.memory_heap_offset;
+
+                const auto cached_texture = std::find_if(
+                    transient_heap.textures.begin(),
+                    transient_heap.textures.end(),
+                    [&texture_descriptor](const TransientTexture &transient_texture)
+                    {
+                        return transient_texture.texture && transient_texture.descriptor == texture_descriptor;
+                    });
+
+                resource.texture = cached_texture != transient_heap.textures.end() ? std::move(cached_texture->texture)
+                                                                                   : m_graphics_device->create_texture(texture_descriptor);
+                transient_textures.push_back({
+                    .descriptor = std::move(texture_descriptor),
+                    .texture = resource.texture,
+                });
+            }
+            else
+            {
+                hyper_rhi::BufferDescriptor buffer_descriptor = resource.buffer_descriptor;
+                buffer_descriptor.memory_heap = transient_heap.memory_heap;
+                buffer_descriptor.memory_heap_offset = resource.memory_heap_offset;
+
+                const auto cached_buffer = std::find_if(
+                    transient_heap.buffers.begin(),
+                    transient_heap.buffers.end(),
+                    [&buffer_descriptor](const TransientBuffer &transient_buffer)
+                    {
+                        return transient_buffer.buffer && transient_buffer.descriptor == buffer_descriptor;
+                    });
+
+                resource.buffer = cached_buffer != transient_heap.buffers.end() ? std::move(cached_buffer->buffer)
+                                                                                : m_graphics_device->create_buffer(buffer_descriptor);
+                transient_buffers.push_back({
+                    .descriptor = std::move(buffer_descriptor),
+                    .buffer = resource.buffer,
+                });
+            }
+        }
+
+        transient_heap.buffers = std::move(transient_buffers);
+        transient_heap.textures = std::move(transient_textures);
+    }
+
+    void RenderGraph::compute_barriers()
+    {
+        std::vector<hyper_rhi::ResourceState> states(m_resources.size());
+        std::vector<bool> last_writes(m_resources.size(), false);
+        for (uint32_t resource_index = 0; resource_index < m_resources.size(); ++resource_index)
+        {
+            states[resource_index] = m_resources[resource_index].initial_state;
+        }
+
+        for (Pass &pass : m_passes)
+        {
+            pass.buffer_barriers.clear();
+            pass.texture_barriers.clear();
+
+            if (pass.culled)
+            {
+                continue;
+            }
+
+            for (const Access &access : pass.accesses)
+            {
+                const Resource &resource = m_resources[access.resource];
+                const hyper_rhi::ResourceState state_before = states[access.resource];
+
+                // NOTE: Reads in the same state can run back to back, everything else needs a barrier
+                bool needs_barrier = state_before != access.state || last_writes[access.resource] || access.write;
+
+                // NOTE: Buffers have no layout, their first use only has to wait if the memory had a previous user
+                if (resource.type == ResourceType::Buffer && state_before == hyper_rhi::ResourceState::Undefined && !resource.aliased)
+                {
+                    needs_barrier = false;
+                }
+
+                states[access.resource] = access.state;
+                last_writes[access.resource] = access.write;
+
+                if (!needs_barrier)
+                {
+                    continue;
+                }
+
+                if (resource.type == ResourceType::Texture)
+                {
+                    pass.texture_barriers.push_back({
+                        .texture = resource.texture,
+                        .state_before = state_before,
+                        .state_after = access.state,
+                    });
+                }
+                else
+                {
+                    pass.buffer_barriers.push_back({
+                        .buffer = resource.buffer,
+                        .state_before = state_before,
+                        .state_after = access.state,
+                    });
+                }
+            }
+
+            const size_t barrier_count = pass.buffer_barriers.size() + pass.texture_barriers.size();
+            m_statistics.barrier_count += static_cast<uint32_t>(barrier_count);
+            m_statistics.barrier_batch_count += barrier_count > 0 ? 1 : 0;
+        }
+
+        for (uint32_t resource_index = 0; resource_index < m_resources.size(); ++resource_index)
+        {
+            const Resource &resource = m_resources[resource_index];
+            if (!resource.imported || resource.final_state == hyper_rhi::ResourceState::Undefined ||
+                resource.final_state == states[resource_index])
+            {
+                continue;
+            }
+
+            if (resource.type == ResourceType::Texture)
+            {
+                m_final_texture_barriers.push_back({
+                    .texture = resource.texture,
+                    .state_before = states[resource_index],
+                    .state_after = resource.final_state,
+                });
+            }
+            else
+            {
+                m_final_buffer_barriers.push_back({
+                    .buffer = resource.buffer,
+                    .state_before = states[resource_index],
+                    .state_after = resource.final_state,
+                });
+            }
+        }
+
+        const size_t final_barrier_count = m_final_buffer_barriers.size() + m_final_texture_barriers.size();
+        m_statistics.barrier_count += static_cast<uint32_t>(final_barrier_count);
+        m_statistics.barrier_batch_count += final_barrier_count > 0 ? 1 : 0;
+    }
+} // namespace hyper_render
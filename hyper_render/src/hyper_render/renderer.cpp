@@ -7,31 +7,54 @@
 #include "hyper_render/renderer.hpp"
 
 #include <array>
+#include <chrono>
+#include <cstring>
+#include <optional>
 
 #include <glm/glm.hpp>
 
-#include <hyper_core/filesystem.hpp>
 #include <hyper_core/logger.hpp>
+#include <hyper_core/profiler.hpp>
 
 struct Material
 {
     glm::vec4 base_color;
 };
 
+// NOTE: Buffer references hold either a device address or a descriptor index in their lower half
 struct Mesh
 {
-    uint32_t positions;
-    uint32_t normals;
-    uint32_t padding_0;
-    uint32_t padding_1;
+    uint64_t positions;
+    uint64_t normals;
 };
 
-struct ObjectPushConstants
+// NOTE: Per-object data lives in an instance buffer, the indirect draws select an object through their first instance
+struct Object
 {
-    uint32_t mesh;
-    uint32_t material;
-    uint32_t padding_0;
-    uint32_t padding_1;
+    uint64_t mesh;
+    uint64_t material;
+};
+
+struct DrawPushConstants
+{
+    hyper_rhi::TransientBuffer objects;
+    hyper_rhi::TransientBuffer frame;
+};
+
+struct Frame
+{
+    float time;
+    float delta_time;
+    float unused_0;
+    float unused_1;
+
+    uint32_t frame_count;
+    uint32_t unused_2;
+    uint32_t unused_3;
+    uint32_t unused_4;
+
+    glm::vec2 screen_size;
+    glm::vec2 unused_5;
 };
 
 namespace hyper_render
@@ -60,55 +83,87 @@ namespace hyper_render
         0, 1, 2, 2, 3, 0,
     };
 
+    static constexpr uint32_t s_max_object_count = 1;
+
     Renderer::Renderer(const RendererDescriptor &descriptor)
         : m_graphics_device(descriptor.graphics_device)
         , m_surface(descriptor.surface)
-        , m_command_list(m_graphics_device->create_command_list())
+        , m_width(descriptor.width)
+        , m_height(descriptor.height)
+        , m_buffer_device_address(descriptor.buffer_device_address && m_graphics_device->buffer_device_address_supported())
+        , m_shader_library({
+              .graphics_device = m_graphics_device,
+              .thread_pool = descriptor.thread_pool,
+              .shader_directory = "./assets/shaders",
+              .cache_directory = "./shader_cache",
+              .defines = m_buffer_device_address ? std::vector<std::string>{ "HE_BUFFER_DEVICE_ADDRESS" } : std::vector<std::string>{},
+              .hot_reload = descriptor.hot_reload,
+          })
+        , m_render_graph({
+              .graphics_device = m_graphics_device,
+          })
+        , m_command_list(m_graphics_device->create_command_list({
+              .queue_type = hyper_rhi::QueueType::Graphics,
+          }))
+        , m_frame_allocator(
+              *m_graphics_device,
+              {
+                  .label = "Frame Allocator",
+                  .byte_size = 4 * 1024 * 1024,
+                  .is_device_addressable = false,
+              })
         , m_pipeline_layout(m_graphics_device->create_pipeline_layout({
               .label = "Opaque Pipeline Layout",
-              .push_constant_size = sizeof(ObjectPushConstants),
-          }))
-        , m_vertex_shader(m_graphics_device->create_shader_module({
-              .label = "Opaque Vertex Shader",
-              .type = hyper_rhi::ShaderType::Vertex,
-              .entry_name = "vs_main",
-              .bytes = hyper_core::filesystem::read_file("./assets/shaders/opaque_shaders.hlsl"),
-          }))
-        , m_fragment_shader(m_graphics_device->create_shader_module({
-              .label = "Opaque Fragment Shader",
-              .type = hyper_rhi::ShaderType::Fragment,
-              .entry_name = "fs_main",
-              .bytes = hyper_core::filesystem::read_file("./assets/shaders/opaque_shaders.hlsl"),
-          }))
-        , m_pipeline(m_graphics_device->create_graphics_pipeline({
-              .label = "Opaque Pipeline",
-              .layout = m_pipeline_layout,
-              .vertex_shader = m_vertex_shader,
-              .fragment_shader = m_fragment_shader,
+              .push_constant_size = sizeof(DrawPushConstants),
           }))
+        , m_opaque_pipeline(m_shader_library.add_graphics_pipeline(
+              {
+                  .label = "Opaque Pipeline",
+                  .layout = m_pipeline_layout,
+                  .vertex_shader = nullptr,
+                  .fragment_shader = nullptr,
+                  .color_attachment_format = m_surface->format(),
+                  .depth_attachment_format = hyper_rhi::TextureFormat::Unknown,
+              },
+              {
+                  .label = "Opaque Vertex Shader",
+                  .type = hyper_rhi::ShaderType::Vertex,
+                  .file_path = "./assets/shaders/opaque_shader.hlsl",
+                  .entry_name = "vs_main",
+              },
+              {
+                  .label = "Opaque Fragment Shader",
+                  .type = hyper_rhi::ShaderType::Fragment,
+                  .file_path = "./assets/shaders/opaque_shader.hlsl",
+                  .entry_name = "fs_main",
+              }))
         , m_material_buffer(m_graphics_device->create_buffer({
               .label = "Material Buffer",
               .byte_size = sizeof(s_materials),
               .is_index_buffer = false,
               .is_constant_buffer = true,
+              .is_device_addressable = m_buffer_device_address,
           }))
         , m_positions_buffer(m_graphics_device->create_buffer({
               .label = "Positions Buffer",
               .byte_size = sizeof(s_positions),
               .is_index_buffer = false,
               .is_constant_buffer = true,
+              .is_device_addressable = m_buffer_device_address,
           }))
         , m_normals_buffer(m_graphics_device->create_buffer({
               .label = "Normals Buffer",
               .byte_size = sizeof(s_normals),
               .is_index_buffer = false,
               .is_constant_buffer = true,
+              .is_device_addressable = m_buffer_device_address,
           }))
         , m_mesh_buffer(m_graphics_device->create_buffer({
               .label = "Mesh Buffer",
               .byte_size = sizeof(Mesh) * 1,
               .is_index_buffer = false,
               .is_constant_buffer = true,
+              .is_device_addressable = m_buffer_device_address,
           }))
         , m_indices_buffer(m_graphics_device->create_buffer({
               .label = "Indices Buffer",
@@ -116,26 +171,228 @@ namespace hyper_render
               .is_index_buffer = true,
               .is_constant_buffer = false,
           }))
+        , m_argument_buffer(m_graphics_device->create_buffer({
+              .label = "Draw Argument Buffer",
+              .byte_size = sizeof(hyper_rhi::DrawIndexedIndirectArguments) * s_max_object_count,
+              .is_index_buffer = false,
+              .is_constant_buffer = false,
+              .is_argument_buffer = true,
+          }))
+        , m_count_buffer(m_graphics_device->create_buffer({
+              .label = "Draw Count Buffer",
+              .byte_size = sizeof(uint32_t),
+              .is_index_buffer = false,
+              .is_constant_buffer = false,
+              .is_argument_buffer = true,
+          }))
+        , m_object_count(1)
+        , m_start_time(std::chrono::steady_clock::now())
+        , m_last_frame_time(m_start_time)
         , m_frame_index(1)
+    {
+        m_graphics_device->write_buffer(m_material_buffer, 0, s_materials.data(), sizeof(s_materials));
+        m_graphics_device->write_buffer(m_positions_buffer, 0, s_positions.data(), sizeof(s_positions));
+        m_graphics_device->write_buffer(m_normals_buffer, 0, s_normals.data(), sizeof(s_normals));
+        m_graphics_device->write_buffer(m_indices_buffer, 0, s_indices.data(), sizeof(s_indices));
+
+        const Mesh mesh = {
+            .positions = this->buffer_reference(m_positions_buffer),
+            .normals = this->buffer_reference(m_normals_buffer),
+        };
+        m_graphics_device->write_buffer(m_mesh_buffer, 0, &mesh, sizeof(Mesh));
+
+        std::array<hyper_rhi::DrawIndexedIndirectArguments, s_max_object_count> draw_arguments = {};
+        for (uint32_t object_index = 0; object_index < m_object_count; ++object_index)
+        {
+            draw_arguments[object_index] = {
+                .index_count = static_cast<uint32_t>(s_indices.size()),
+                .instance_count = 1,
+                .first_index = 0,
+                .vertex_offset = 0,
+                .first_instance = object_index,
+            };
+        }
+        m_graphics_device->write_buffer(m_argument_buffer, 0, draw_arguments.data(), sizeof(draw_arguments));
+        m_graphics_device->write_buffer(m_count_buffer, 0, &m_object_count, sizeof(uint32_t));
+
+        m_graphics_device->add_memory_budget_callback({
+            .threshold = 0.9f,
+            .callback =
+                [](const hyper_rhi::MemoryBudgetEvent &event)
+                {
+                    if (event.exceeded)
+                    {
+                        HE_WARN("Memory heap #{} uses {} of {} bytes of its budget", event.heap.heap_index, event.heap.usage, event.heap.budget);
+                        return;
+                    }
+
+                    HE_INFO("Memory heap #{} is back within its budget", event.heap.heap_index);
+                },
+        });
+
+        if (descriptor.buffer_device_address && !m_buffer_device_address)
+        {
+            HE_WARN("Buffer device addresses were requested, but are not available, falling back to buffer descriptors");
+        }
+
+        HE_DEBUG("Created Renderer with {}", m_buffer_device_address ? "buffer device addresses" : "buffer descriptors");
+    }
+
+    Renderer::~Renderer()
     {
         m_graphics_device->wait_for_idle();
+    }
 
-        HE_DEBUG("Created Renderer");
+    void Renderer::wait_for_frame() const
+    {
+        m_graphics_device->wait_for_frame(m_frame_index);
+    }
+
+    void Renderer::resize(const uint32_t width, const uint32_t height)
+    {
+        m_width = width;
+        m_height = height;
+
+        m_surface->resize(width, height);
     }
 
     void Renderer::render()
     {
-        m_graphics_device->begin_frame(m_surface, m_frame_index);
+        hyper_core::Profiler::begin_frame(m_frame_index);
+
+        HE_PROFILE_SCOPE("Render");
+
+        m_shader_library.update();
+
+        {
+            HE_PROFILE_SCOPE("Begin Frame");
+
+            m_graphics_device->begin_frame(m_surface, m_frame_index);
+        }
+
+        // NOTE: begin_frame waited for the frame that last used this slot, so its constants can be overwritten
+        m_frame_allocator.begin_frame(m_frame_index);
+
+        const std::chrono::steady_clock::time_point current_time = std::chrono::steady_clock::now();
+        const Frame frame = {
+            .time = std::chrono::duration<float>(current_time - m_start_time).count(),
+            .delta_time = std::chrono::duration<float>(current_time - m_last_frame_time).count(),
+            .unused_0 = 0.0f,
+            .unused_1 = 0.0f,
+            .frame_count = m_frame_index,
+            .unused_2 = 0,
+            .unused_3 = 0,
+            .unused_4 = 0,
+            .screen_size = glm::vec2(static_cast<float>(m_width), static_cast<float>(m_height)),
+            .unused_5 = glm::vec2(0.0f),
+        };
+        m_last_frame_time = current_time;
+
+        const std::optional<hyper_rhi::FrameAllocation> objects = m_frame_allocator.allocate(sizeof(Object) * m_object_count);
+        const std::optional<hyper_rhi::TransientBuffer> frame_buffer = m_frame_allocator.write(frame);
+
+        // NOTE: Without its constants the opaque pass still clears the swapchain, but skips the draw
+        std::optional<DrawPushConstants> draw_push_constants;
+        if (objects && frame_buffer)
+        {
+            for (uint32_t object_index = 0; object_index < m_object_count; ++object_index)
+            {
+                const Object object = {
+                    .mesh = this->buffer_reference(m_mesh_buffer),
+                    .material = this->buffer_reference(m_material_buffer),
+                };
+                std::memcpy(objects->mapped_data + sizeof(Object) * object_index, &object, sizeof(Object));
+            }
+
+            draw_push_constants = DrawPushConstants{
+                .objects = objects->buffer,
+                .frame = *frame_buffer,
+            };
+        }
+
+        m_render_graph.begin_frame(m_frame_index);
+
+        const RenderGraphTexture swapchain_texture = m_render_graph.import_texture(
+            "Swapchain Texture", m_surface->current_texture(), hyper_rhi::ResourceState::Undefined, hyper_rhi::ResourceState::Present);
 
-        m_command_list->begin();
+        const RenderGraphBuffer argument_buffer = m_render_graph.import_buffer(
+            "Draw Argument Buffer", m_argument_buffer, hyper_rhi::ResourceState::IndirectArgument, hyper_rhi::ResourceState::IndirectArgument);
+        const RenderGraphBuffer count_buffer = m_render_graph.import_buffer(
+            "Draw Count Buffer", m_count_buffer, hyper_rhi::ResourceState::IndirectArgument, hyper_rhi::ResourceState::IndirectArgument);
 
-        m_command_list->end();
+        m_render_graph.add_pass("Opaque Pass")
+            .read(argument_buffer, hyper_rhi::ResourceState::IndirectArgument)
+            .read(count_buffer, hyper_rhi::ResourceState::IndirectArgument)
+            .write(swapchain_texture, hyper_rhi::ResourceState::ColorAttachment)
+            .execute(
+                [this, swapchain_texture, argument_buffer, count_buffer, draw_push_constants](
+                    const RenderGraph &render_graph,
+                    hyper_rhi::CommandList &command_list)
+                {
+                    command_list.begin_render_pass({
+                        .label = "Opaque Pass",
+                        .color_attachment = render_graph.texture(swapchain_texture),
+                    });
+
+                    const hyper_rhi::GraphicsPipelineHandle &opaque_pipeline = m_shader_library.graphics_pipeline(m_opaque_pipeline);
+                    if (!opaque_pipeline || !draw_push_constants)
+                    {
+                        command_list.end_render_pass();
+                        return;
+                    }
+
+                    command_list.set_pipeline(opaque_pipeline);
+                    command_list.set_index_buffer(m_indices_buffer);
+                    command_list.set_push_constants(&*draw_push_constants, sizeof(DrawPushConstants));
+
+                    // NOTE: The whole pass is a single call, the count buffer can later be filled by GPU culling
+                    if (m_graphics_device->draw_indirect_count_supported())
+                    {
+                        command_list.draw_indexed_indirect_count(
+                            render_graph.buffer(argument_buffer), 0, render_graph.buffer(count_buffer), 0, s_max_object_count);
+                    }
+                    else
+                    {
+                        command_list.draw_indexed_indirect(render_graph.buffer(argument_buffer), 0, m_object_count);
+                    }
+
+                    command_list.end_render_pass();
+                });
+
+        m_render_graph.compile();
+
+        {
+            HE_PROFILE_SCOPE("Record");
+
+            m_command_list->begin();
+
+            m_render_graph.execute(*m_command_list);
+
+            m_command_list->end();
+        }
 
         m_graphics_device->end_frame();
 
-        m_graphics_device->execute();
-        m_graphics_device->present(m_surface);
+        const std::array<hyper_rhi::SubmitDescriptor, 1> submit_descriptors = {
+            hyper_rhi::SubmitDescriptor{
+                .command_list = m_command_list,
+                .wait_points = {},
+                .signal_value = 0,
+            },
+        };
+        {
+            HE_PROFILE_SCOPE("Submit");
+
+            m_graphics_device->execute(submit_descriptors);
+            m_graphics_device->present(m_surface);
+        }
 
         m_frame_index += 1;
     }
+
+    uint64_t Renderer::buffer_reference(const hyper_rhi::BufferHandle &buffer) const
+    {
+        return m_buffer_device_address ? buffer->device_address() : buffer->handle().handle();
+    }
+
 } // namespace hyper_render
\ No newline at end of file
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_render/shader_library.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/logger.hpp>
+#include <hyper_core/profiler.hpp>
+
+namespace hyper_render
+{
+    ShaderLibrary::ShaderLibrary(const ShaderLibraryDescriptor &descriptor)
+        : m_graphics_device(descriptor.graphics_device)
+        , m_thread_pool(descriptor.thread_pool)
+        , m_defines(descriptor.defines)
+        , m_shader_compiler({
+              .cache_directory = descriptor.cache_directory,
+          })
+        , m_file_watcher(nullptr)
+        , m_shaders()
+        , m_graphics_pipelines()
+        , m_dependents()
+        , m_pending_compilations()
+        , m_pending_pipelines()
+    {
+        if (descriptor.hot_reload)
+        {
+            m_file_watcher = std::make_unique<hyper_platform::FileWatcher>(hyper_platform::FileWatcherDescriptor{
+                .directory = descriptor.shader_directory,
+            });
+        }
+    }
+
+    ShaderLibrary::~ShaderLibrary()
+    {
+        // NOTE: In-flight jobs reference the compiler and the device, so they have to finish first
+        for (const PendingCompilation &pending_compilation : m_pending_compilations)
+        {
+            pending_compilation.result.wait();
+        }
+
+        for (const PendingPipeline &pending_pipeline : m_pending_pipelines)
+        {
+            pending_pipeline.pipeline.wait();
+        }
+    }
+
+    uint32_t ShaderLibrary::add_graphics_pipeline(
+        const hyper_rhi::GraphicsPipelineDescriptor &descriptor,
+        const ShaderDescriptor &vertex_shader,
+        const ShaderDescriptor &fragment_shader)
+    {
+        const uint32_t vertex_shader_index = this->load_shader(vertex_shader);
+        const uint32_t fragment_shader_index = this->load_shader(fragment_shader);
+
+        hyper_rhi::GraphicsPipelineDescriptor pipeline_descriptor = descriptor;
+        pipeline_descriptor.vertex_shader = m_shaders[vertex_shader_index].shader_module;
+        pipeline_descriptor.fragment_shader = m_shaders[fragment_shader_index].shader_module;
+
+        // NOTE: A pipeline with a shader that failed to compile stays empty until a reload of that shader succeeds
+        hyper_rhi::GraphicsPipelineHandle pipeline = nullptr;
+        if (pipeline_descriptor.vertex_shader && pipeline_descriptor.fragment_shader)
+        {
+            pipeline = m_graphics_device->create_graphics_pipeline(pipeline_descriptor);
+        }
+
+        m_graphics_pipelines.push_back({
+            .descriptor = descriptor,
+            .vertex_shader = vertex_shader_index,
+            .fragment_shader = fragment_shader_index,
+            .pipeline = std::move(pipeline),
+            .latest_generation = 0,
+            .installed_generation = 0,
+        });
+
+        return static_cast<uint32_t>(m_graphics_pipelines.size() - 1);
+    }
+
+    const hyper_rhi::GraphicsPipelineHandle &ShaderLibrary::graphics_pipeline(const uint32_t graphics_pipeline) const
+    {
+        HE_ASSERT(graphics_pipeline < m_graphics_pipelines.size());
+
+        return m_graphics_pipelines[graphics_pipeline].pipeline;
+    }
+
+    void ShaderLibrary::update()
+    {
+        HE_PROFILE_SCOPE("Shader Library Update");
+
+        if (m_file_watcher)
+        {
+            for (const std::string &file_path : m_file_watcher->poll())
+            {
+                this->recompile_dependents(ShaderLibrary::normalize_path(file_path));
+            }
+        }
+
+        this->collect_compilations();
+        this->collect_pipelines();
+    }
+
+    uint32_t ShaderLibrary::load_shader(const ShaderDescriptor &descriptor)
+    {
+        const auto shader_iterator = std::find_if(
+            m_shaders.begin(),
+            m_shaders.end(),
+            [&descriptor](const Shader &shader)
+            {
+                return shader.descriptor.type == descriptor.type && shader.descriptor.file_path == descriptor.file_path &&
+                       shader.descriptor.entry_name == descriptor.entry_name;
+            });
+        if (shader_iterator != m_shaders.end())
+        {
+            return static_cast<uint32_t>(std::distance(m_shaders.begin(), shader_iterator));
+        }
+
+        Shader shader = {
+            .descriptor = descriptor,
+            .shader_module = nullptr,
+            .dependencies = {},
+            .latest_generation = 0,
+            .installed_generation = 0,
+        };
+
+        shader.dependencies.push_back(ShaderLibrary::normalize_path(descriptor.file_path));
+
+        // NOTE: A failed shader is still registered, so that fixing its source file reloads it like any other shader
+        std::optional<hyper_rhi::ShaderCompilationResult> result = m_shader_compiler.compile(this->compilation_descriptor(descriptor));
+        if (result)
+        {
+            shader.shader_module = this->create_shader_module(descriptor, std::move(result->bytes));
+            for (const std::string &include_path : result->include_paths)
+            {
+                shader.dependencies.push_back(ShaderLibrary::normalize_path(include_path));
+            }
+        }
+        else
+        {
+            HE_ERROR("Failed to compile shader '{}:{}'", descriptor.file_path, descriptor.entry_name);
+        }
+
+        m_shaders.push_back(std::move(shader));
+        this->rebuild_dependency_graph();
+
+        return static_cast<uint32_t>(m_shaders.size() - 1);
+    }
+
+    hyper_rhi::ShaderCompilationDescriptor ShaderLibrary::compilation_descriptor(const ShaderDescriptor &descriptor) const
+    {
+        return {
+            .graphics_api = m_graphics_device->graphics_api(),
+            .file_path = descriptor.file_path,
+            .type = descriptor.type,
+            .entry_name = descriptor.entry_name,
+            .defines = m_defines,
+        };
+    }
+
+    hyper_rhi::ShaderModuleHandle ShaderLibrary::create_shader_module(const ShaderDescriptor &descriptor, std::vector<uint8_t> bytes) const
+    {
+        return m_graphics_device->create_shader_module({
+            .label = descriptor.label,
+            .type = descriptor.type,
+            .entry_name = descriptor.entry_name,
+            .bytes = std::move(bytes),
+        });
+    }
+
+    void ShaderLibrary::recompile_dependents(const std::string &file_path)
+    {
+        const auto dependents = m_dependents.find(file_path);
+        if (dependents == m_dependents.end())
+        {
+            return;
+        }
+
+        for (const uint32_t shader_index : dependents->second)
+        {
+            Shader &shader = m_shaders[shader_index];
+            HE_INFO("Reloading shader '{}' after '{}' changed", shader.descriptor.label, file_path);
+
+            const uint64_t generation = ++shader.latest_generation;
+
+            hyper_rhi::ShaderCompilationDescriptor compilation_descriptor = this->compilation_descriptor(shader.descriptor);
+            if (m_thread_pool == nullptr)
+            {
+                std::promise<std::optional<hyper_rhi::ShaderCompilationResult>> promise;
+                promise.set_value(m_shader_compiler.compile(compilation_descriptor));
+
+                m_pending_compilations.push_back({
+                    .shader = shader_index,
+                    .generation = generation,
+                    .result = promise.get_future(),
+                });
+                continue;
+            }
+
+            m_pending_compilations.push_back({
+                .shader = shader_index,
+                .generation = generation,
+                .result = m_thread_pool->submit(
+                    [this, compilation_descriptor = std::move(compilation_descriptor)]()
+                    {
+                        return m_shader_compiler.compile(compilation_descriptor);
+                    }),
+            });
+        }
+    }
+
+    void ShaderLibrary::collect_compilations()
+    {
+        std::vector<uint32_t> reloaded_shaders;
+        for (auto pending_compilation = m_pending_compilations.begin(); pending_compilation != m_pending_compilations.end();)
+        {
+            if (pending_compilation->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++pending_compilation;
+                continue;
+            }
+
+            const uint32_t shader_index = pending_compilation->shader;
+            const uint64_t generation = pending_compilation->generation;
+
+            std::optional<hyper_rhi::ShaderCompilationResult> result = pending_compilation->result.get();
+            pending_compilation = m_pending_compilations.erase(pending_compilation);
+
+            // NOTE: A newer compilation of the same shader finished first, its result wins
+            Shader &shader = m_shaders[shader_index];
+            if (generation <= shader.installed_generation)
+            {
+                continue;
+            }
+
+            if (!result)
+            {
+                HE_WARN("Keeping previous version of shader '{}'", shader.descriptor.label);
+                continue;
+            }
+
+            shader.shader_module = this->create_shader_module(shader.descriptor, std::move(result->bytes));
+            shader.installed_generation = generation;
+
+            shader.dependencies.clear();
+            shader.dependencies.push_back(ShaderLibrary::normalize_path(shader.descriptor.file_path));
+            for (const std::string &include_path : result->include_paths)
+            {
+                shader.dependencies.push_back(ShaderLibrary::normalize_path(include_path));
+            }
+
+            reloaded_shaders.push_back(shader_index);
+        }
+
+        if (reloaded_shaders.empty())
+        {
+            return;
+        }
+
+        this->rebuild_dependency_graph();
+
+        for (uint32_t pipeline_index = 0; pipeline_index < m_graphics_pipelines.size(); ++pipeline_index)
+        {
+            GraphicsPipeline &graphics_pipeline = m_graphics_pipelines[pipeline_index];
+
+            const bool affected = std::any_of(
+                reloaded_shaders.begin(),
+                reloaded_shaders.end(),
+                [&graphics_pipeline](const uint32_t shader_index)
+                {
+                    return graphics_pipeline.vertex_shader == shader_index || graphics_pipeline.fragment_shader == shader_index;
+                });
+            if (!affected)
+            {
+                continue;
+            }
+
+            hyper_rhi::GraphicsPipelineDescriptor pipeline_descriptor = graphics_pipeline.descriptor;
+            pipeline_descriptor.vertex_shader = m_shaders[graphics_pipeline.vertex_shader].shader_module;
+            pipeline_descriptor.fragment_shader = m_shaders[graphics_pipeline.fragment_shader].shader_module;
+            if (!pipeline_descriptor.vertex_shader || !pipeline_descriptor.fragment_shader)
+            {
+                continue;
+            }
+
+            m_pending_pipelines.push_back({
+                .graphics_pipeline = pipeline_index,
+                .generation = ++graphics_pipeline.latest_generation,
+                .pipeline = m_graphics_device->create_graphics_pipeline_async(pipeline_descriptor),
+            });
+        }
+    }
+
+    void ShaderLibrary::collect_pipelines()
+    {
+        for (auto pending_pipeline = m_pending_pipelines.begin(); pending_pipeline != m_pending_pipelines.end();)
+        {
+            if (pending_pipeline->pipeline.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++pending_pipeline;
+                continue;
+            }
+
+            const uint32_t pipeline_index = pending_pipeline->graphics_pipeline;
+            const uint64_t generation = pending_pipeline->generation;
+
+            hyper_rhi::GraphicsPipelineHandle pipeline = pending_pipeline->pipeline.get();
+            pending_pipeline = m_pending_pipelines.erase(pending_pipeline);
+
+            GraphicsPipeline &graphics_pipeline = m_graphics_pipelines[pipeline_index];
+            if (generation <= graphics_pipeline.installed_generation)
+            {
+                continue;
+            }
+
+            // NOTE: The previous pipeline may still be in flight, its destructor defers the actual destruction
+            graphics_pipeline.pipeline = std::move(pipeline);
+            graphics_pipeline.installed_generation = generation;
+
+            HE_INFO("Swapped pipeline '{}'", graphics_pipeline.descriptor.label);
+        }
+    }
+
+    void ShaderLibrary::rebuild_dependency_graph()
+    {
+        m_dependents.clear();
+        for (uint32_t shader_index = 0; shader_index < m_shaders.size(); ++shader_index)
+        {
+            for (const std::string &dependency : m_shaders[shader_index].dependencies)
+            {
+                m_dependents[dependency].push_back(shader_index);
+            }
+        }
+    }
+
+    std::string ShaderLibrary::normalize_path(const std::string &file_path)
+    {
+        std::error_code error_code;
+        const std::filesystem::path canonical_path = std::filesystem::weakly_canonical(file_path, error_code);
+        if (error_code)
+        {
+            return std::filesystem::path(file_path).lexically_normal().generic_string();
+        }
+
+        return canonical_path.generic_string();
+    }
+} // namespace hyper_render
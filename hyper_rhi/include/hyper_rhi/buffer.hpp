@@ -9,8 +9,19 @@
 #include <memory>
 #include <string>
 
+#include "hyper_rhi/memory_heap.hpp"
+#include "hyper_rhi/resource_handle.hpp"
+
 namespace hyper_rhi
 {
+    enum class MemoryLocation
+    {
+        GpuOnly,
+        Upload,
+        Readback,
+        GpuUpload,
+    };
+
     struct BufferDescriptor
     {
         std::string label;
@@ -18,12 +29,29 @@ namespace hyper_rhi
         uint64_t byte_size = 0;
         bool is_index_buffer = false;
         bool is_constant_buffer = false;
+        bool is_argument_buffer = false;
+        // NOTE: Device addressable buffers are read through their address and get no storage buffer descriptor
+        bool is_device_addressable = false;
+        MemoryLocation memory_location = MemoryLocation::GpuOnly;
+
+        // NOTE: Placed buffers alias the heap memory at the given offset instead of owning an allocation
+        MemoryHeapHandle memory_heap = nullptr;
+        uint64_t memory_heap_offset = 0;
+
+        bool operator==(const BufferDescriptor &other) const = default;
     };
 
     class Buffer
     {
     public:
         virtual ~Buffer() = default;
+
+        [[nodiscard]] virtual uint64_t byte_size() const = 0;
+        [[nodiscard]] virtual MemoryLocation memory_location() const = 0;
+        [[nodiscard]] virtual uint8_t *mapped_data() const = 0;
+        [[nodiscard]] virtual uint64_t device_address() const = 0;
+
+        [[nodiscard]] virtual ResourceHandle handle() const = 0;
     };
 
     using BufferHandle = std::shared_ptr<Buffer>;
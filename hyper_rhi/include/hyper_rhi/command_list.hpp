@@ -6,18 +6,125 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "hyper_rhi/buffer.hpp"
+#include "hyper_rhi/graphics_pipeline.hpp"
+#include "hyper_rhi/render_pass.hpp"
+#include "hyper_rhi/texture.hpp"
 
 namespace hyper_rhi
 {
+    enum class QueueType
+    {
+        Graphics,
+        Compute,
+        Transfer,
+    };
+
+    enum class ResourceState
+    {
+        Undefined,
+
+        ColorAttachment,
+        DepthStencilAttachment,
+        DepthStencilRead,
+        ShaderResource,
+        UnorderedAccess,
+        ConstantBuffer,
+        IndexBuffer,
+        IndirectArgument,
+        TransferSource,
+        TransferDestination,
+        Present,
+    };
+
+    struct BufferBarrier
+    {
+        BufferHandle buffer = nullptr;
+        ResourceState state_before = ResourceState::Undefined;
+        ResourceState state_after = ResourceState::Undefined;
+    };
+
+    // NOTE: Transitions cover every mip level and array layer of the texture
+    struct TextureBarrier
+    {
+        TextureHandle texture = nullptr;
+        ResourceState state_before = ResourceState::Undefined;
+        ResourceState state_after = ResourceState::Undefined;
+    };
+
+    // NOTE: Matches VkDrawIndexedIndirectCommand and D3D12_DRAW_INDEXED_ARGUMENTS, so argument buffers can be filled on the GPU
+    struct DrawIndexedIndirectArguments
+    {
+        uint32_t index_count = 0;
+        uint32_t instance_count = 0;
+        uint32_t first_index = 0;
+        int32_t vertex_offset = 0;
+        uint32_t first_instance = 0;
+    };
+
+    struct CommandListDescriptor
+    {
+        QueueType queue_type = QueueType::Graphics;
+    };
+
     class CommandList
     {
     public:
         virtual ~CommandList() = default;
 
-        virtual void begin() const = 0;
-        virtual void end() const = 0;
+        [[nodiscard]] virtual QueueType queue_type() const = 0;
+
+        // NOTE: Every list records into its own command buffer, so different lists can be recorded on different threads
+        virtual void begin() = 0;
+        virtual void end() = 0;
+
+        // NOTE: All barriers of one call are recorded as a single batch
+        virtual void barrier(std::span<const BufferBarrier> buffer_barriers, std::span<const TextureBarrier> texture_barriers) = 0;
+
+        // NOTE: Scopes nest, their timings only show up while the profiler is enabled
+        virtual void begin_gpu_scope(std::string_view name) = 0;
+        virtual void end_gpu_scope() = 0;
+
+        // NOTE: The color attachment is cleared on begin, viewport and scissor cover the whole attachment
+        virtual void begin_render_pass(const RenderPassDescriptor &descriptor) = 0;
+        virtual void end_render_pass() = 0;
+
+        virtual void set_pipeline(const GraphicsPipelineHandle &pipeline) = 0;
+        virtual void set_index_buffer(const BufferHandle &buffer) = 0;
+        virtual void set_push_constants(const void *data, size_t byte_size) = 0;
+
+        // NOTE: Reads draw_count tightly packed DrawIndexedIndirectArguments starting at the argument offset
+        virtual void draw_indexed_indirect(const BufferHandle &argument_buffer, uint64_t argument_offset, uint32_t draw_count) = 0;
+
+        // NOTE: The draw count is read from a uint32_t in the count buffer on the GPU and clamped to max_draw_count
+        virtual void draw_indexed_indirect_count(
+            const BufferHandle &argument_buffer,
+            uint64_t argument_offset,
+            const BufferHandle &count_buffer,
+            uint64_t count_offset,
+            uint32_t max_draw_count) = 0;
     };
 
     using CommandListHandle = std::shared_ptr<CommandList>;
+
+    // NOTE: Timeline values are local to the current frame and must increase along the submission order of a queue
+    struct TimelinePoint
+    {
+        QueueType queue_type = QueueType::Graphics;
+        uint64_t value = 0;
+    };
+
+    struct SubmitDescriptor
+    {
+        CommandListHandle command_list = nullptr;
+
+        std::vector<TimelinePoint> wait_points;
+        uint64_t signal_value = 0;
+    };
 } // namespace hyper_rhi
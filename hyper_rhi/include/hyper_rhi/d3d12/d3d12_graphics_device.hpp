@@ -22,19 +22,43 @@ namespace hyper_rhi
         [[nodiscard]] ComPtr<ID3D12CommandQueue> command_queue() const;
 
     protected:
+        [[nodiscard]] GraphicsApi graphics_api() const override;
+        [[nodiscard]] bool buffer_device_address_supported() const override;
+        [[nodiscard]] bool draw_indirect_count_supported() const override;
+
         SurfaceHandle create_surface(const SurfaceDescriptor &descriptor) override;
 
         BufferHandle create_buffer(const BufferDescriptor &descriptor) override;
-        CommandListHandle create_command_list() override;
+        CommandListHandle create_command_list(const CommandListDescriptor &descriptor) override;
         ComputePipelineHandle create_compute_pipeline(const ComputePipelineDescriptor &descriptor) override;
         GraphicsPipelineHandle create_graphics_pipeline(const GraphicsPipelineDescriptor &descriptor) override;
+        MemoryHeapHandle create_memory_heap(const MemoryHeapDescriptor &descriptor) override;
         PipelineLayoutHandle create_pipeline_layout(const PipelineLayoutDescriptor &descriptor) override;
         ShaderModuleHandle create_shader_module(const ShaderModuleDescriptor &descriptor) override;
         TextureHandle create_texture(const TextureDescriptor &descriptor) override;
+        TextureViewHandle create_texture_view(const TextureViewDescriptor &descriptor) override;
+
+        std::shared_future<ComputePipelineHandle> create_compute_pipeline_async(const ComputePipelineDescriptor &descriptor) override;
+        std::shared_future<GraphicsPipelineHandle> create_graphics_pipeline_async(const GraphicsPipelineDescriptor &descriptor) override;
+        void prewarm_pipelines(
+            std::span<const ComputePipelineDescriptor> compute_pipeline_descriptors,
+            std::span<const GraphicsPipelineDescriptor> graphics_pipeline_descriptors) override;
+
+        [[nodiscard]] MemoryRequirements buffer_memory_requirements(const BufferDescriptor &descriptor) const override;
+        [[nodiscard]] MemoryRequirements texture_memory_requirements(const TextureDescriptor &descriptor) const override;
+
+        [[nodiscard]] MemoryStatistics memory_statistics() const override;
+        void add_memory_budget_callback(const MemoryBudgetCallbackDescriptor &descriptor) override;
+
+        void write_buffer(const BufferHandle &buffer_handle, uint64_t offset, const void *data, uint64_t byte_size) override;
+
+        void set_frame_count(uint32_t frame_count) override;
+        [[nodiscard]] uint32_t frame_count() const override;
 
+        void wait_for_frame(uint32_t frame_index) const override;
         void begin_frame(SurfaceHandle surface_handle, uint32_t frame_index) override;
         void end_frame() const override;
-        void execute() const override;
+        void execute(std::span<const SubmitDescriptor> submit_descriptors) const override;
         void present(SurfaceHandle surface_handle) const override;
 
         void wait_for_idle() const override;
@@ -20,6 +20,10 @@ namespace hyper_rhi
     protected:
         void resize(uint32_t width, uint32_t height) override;
 
+        void set_present_mode(PresentMode present_mode) override;
+        [[nodiscard]] PresentMode present_mode() const override;
+
+        [[nodiscard]] TextureFormat format() const override;
         [[nodiscard]] TextureHandle current_texture() const override;
 
     private:
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace hyper_rhi
+{
+    // NOTE: Lock-free free list of descriptor indices, safe to use from any number of threads
+    class DescriptorIndexAllocator
+    {
+    public:
+        static constexpr uint32_t s_invalid_index = 0xFFFFFFFF;
+
+    public:
+        explicit DescriptorIndexAllocator(uint32_t capacity);
+
+        [[nodiscard]] uint32_t allocate();
+        void free(uint32_t index);
+
+        [[nodiscard]] uint32_t capacity() const;
+
+    private:
+        static uint64_t pack(uint32_t index, uint32_t tag);
+        static uint32_t unpack_index(uint64_t head);
+        static uint32_t unpack_tag(uint64_t head);
+
+    private:
+        uint32_t m_capacity;
+
+        // NOTE: The head packs the top index with a tag that changes on every update to avoid ABA
+        alignas(64) std::atomic<uint64_t> m_free_head;
+        alignas(64) std::atomic<uint32_t> m_current_index;
+
+        std::unique_ptr<std::atomic<uint32_t>[]> m_next_indices;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+
+#include "hyper_rhi/graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    // NOTE: Matches TransientBuffer in globals.hlsli, so it can be copied into push constants as is
+    struct TransientBuffer
+    {
+        ResourceHandle handle;
+        uint32_t offset;
+    };
+
+    struct FrameAllocation
+    {
+        TransientBuffer buffer;
+        uint64_t device_address;
+        uint8_t *mapped_data;
+    };
+
+    struct FrameAllocatorDescriptor
+    {
+        std::string label;
+
+        // NOTE: Capacity of every frame slot, one slot is allocated per frame in flight
+        uint64_t byte_size = 4 * 1024 * 1024;
+        bool is_device_addressable = false;
+    };
+
+    // NOTE: Hands out sub-ranges of a persistently mapped buffer, everything allocated during a frame lives until its slot is reused
+    class FrameAllocator
+    {
+    public:
+        static constexpr uint64_t s_default_alignment = 16;
+
+    public:
+        FrameAllocator(GraphicsDevice &graphics_device, const FrameAllocatorDescriptor &descriptor);
+
+        // NOTE: Must be called after waiting for the frame, which guarantees the GPU finished reading the slot
+        void begin_frame(uint32_t frame_index);
+
+        // NOTE: Returns nothing when the slot is full, the head is left untouched so smaller allocations may still fit
+        [[nodiscard]] std::optional<FrameAllocation> allocate(uint64_t byte_size, uint64_t alignment = s_default_alignment);
+
+        template <typename T>
+        [[nodiscard]] std::optional<TransientBuffer> write(const T &value)
+        {
+            const std::optional<FrameAllocation> allocation = this->allocate(sizeof(T));
+            if (!allocation)
+            {
+                return std::nullopt;
+            }
+
+            std::memcpy(allocation->mapped_data, &value, sizeof(T));
+            return allocation->buffer;
+        }
+
+        [[nodiscard]] uint64_t byte_size() const;
+        [[nodiscard]] uint64_t used_byte_size() const;
+
+    private:
+        uint64_t m_byte_size;
+
+        // NOTE: Slot reuse is safe for every frame count, since waiting for a frame implies all earlier frames completed
+        std::array<BufferHandle, GraphicsDevice::s_max_frame_count> m_buffers;
+        uint32_t m_current_slot;
+
+        std::atomic<uint64_t> m_head;
+    };
+} // namespace hyper_rhi
@@ -6,16 +6,24 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
+#include <span>
+#include <string>
+
+#include <hyper_core/thread_pool.hpp>
 
 #include "hyper_rhi/buffer.hpp"
 #include "hyper_rhi/command_list.hpp"
 #include "hyper_rhi/compute_pipeline.hpp"
 #include "hyper_rhi/graphics_pipeline.hpp"
+#include "hyper_rhi/memory_budget.hpp"
+#include "hyper_rhi/memory_heap.hpp"
 #include "hyper_rhi/pipeline_layout.hpp"
 #include "hyper_rhi/shader_module.hpp"
 #include "hyper_rhi/surface.hpp"
 #include "hyper_rhi/texture.hpp"
+#include "hyper_rhi/texture_view.hpp"
 
 namespace hyper_rhi
 {
@@ -23,37 +31,80 @@ namespace hyper_rhi
     {
         D3D12,
         Vulkan,
+        Null,
     };
 
     struct GraphicsDeviceDescriptor
     {
         GraphicsApi graphics_api = GraphicsApi::Vulkan;
         bool debug_mode = false;
+        uint32_t frame_count = 2;
+        uint64_t staging_ring_size = 64 * 1024 * 1024;
+        std::string pipeline_cache_path = "pipeline_cache.bin";
+        // NOTE: Index or case-insensitive name substring of the adapter to use, empty picks the highest rated one
+        std::string adapter;
+        hyper_core::ThreadPool *thread_pool = nullptr;
     };
 
     class GraphicsDevice
     {
     public:
-        static constexpr size_t s_frame_count = 2;
+        static constexpr uint32_t s_min_frame_count = 1;
+        static constexpr uint32_t s_max_frame_count = 3;
+        static constexpr size_t s_queue_type_count = 3;
         static constexpr size_t s_descriptor_limit = 1000 * 1000;
 
     public:
         static std::shared_ptr<GraphicsDevice> create(const GraphicsDeviceDescriptor &descriptor);
         virtual ~GraphicsDevice() = default;
 
+        [[nodiscard]] virtual GraphicsApi graphics_api() const = 0;
+
+        // NOTE: Device addressable buffers can be read through 64-bit pointers in shaders instead of storage buffer descriptors
+        [[nodiscard]] virtual bool buffer_device_address_supported() const = 0;
+
+        // NOTE: Without it, indirect draws have to pass the draw count from the CPU
+        [[nodiscard]] virtual bool draw_indirect_count_supported() const = 0;
+
         [[nodiscard]] virtual SurfaceHandle create_surface(const SurfaceDescriptor &descriptor) = 0;
 
         [[nodiscard]] virtual BufferHandle create_buffer(const BufferDescriptor &descriptor) = 0;
-        [[nodiscard]] virtual CommandListHandle create_command_list() = 0;
+        [[nodiscard]] virtual CommandListHandle create_command_list(const CommandListDescriptor &descriptor) = 0;
         [[nodiscard]] virtual ComputePipelineHandle create_compute_pipeline(const ComputePipelineDescriptor &descriptor) = 0;
         [[nodiscard]] virtual GraphicsPipelineHandle create_graphics_pipeline(const GraphicsPipelineDescriptor &descriptor) = 0;
+        [[nodiscard]] virtual MemoryHeapHandle create_memory_heap(const MemoryHeapDescriptor &descriptor) = 0;
         [[nodiscard]] virtual PipelineLayoutHandle create_pipeline_layout(const PipelineLayoutDescriptor &descriptor) = 0;
         [[nodiscard]] virtual ShaderModuleHandle create_shader_module(const ShaderModuleDescriptor &descriptor) = 0;
         [[nodiscard]] virtual TextureHandle create_texture(const TextureDescriptor &descriptor) = 0;
+        [[nodiscard]] virtual TextureViewHandle create_texture_view(const TextureViewDescriptor &descriptor) = 0;
+
+        [[nodiscard]] virtual std::shared_future<ComputePipelineHandle> create_compute_pipeline_async(
+            const ComputePipelineDescriptor &descriptor) = 0;
+        [[nodiscard]] virtual std::shared_future<GraphicsPipelineHandle> create_graphics_pipeline_async(
+            const GraphicsPipelineDescriptor &descriptor) = 0;
+        virtual void prewarm_pipelines(
+            std::span<const ComputePipelineDescriptor> compute_pipeline_descriptors,
+            std::span<const GraphicsPipelineDescriptor> graphics_pipeline_descriptors) = 0;
+
+        // NOTE: Queried without creating the resource, used to place resources into memory heaps
+        [[nodiscard]] virtual MemoryRequirements buffer_memory_requirements(const BufferDescriptor &descriptor) const = 0;
+        [[nodiscard]] virtual MemoryRequirements texture_memory_requirements(const TextureDescriptor &descriptor) const = 0;
+
+        // NOTE: Heap budgets are refreshed at the start of every frame, callbacks are invoked from begin_frame
+        [[nodiscard]] virtual MemoryStatistics memory_statistics() const = 0;
+        virtual void add_memory_budget_callback(const MemoryBudgetCallbackDescriptor &descriptor) = 0;
+
+        // NOTE: The copy runs before the next submitted frame and after all earlier frames, so in-flight reads see the old contents
+        virtual void write_buffer(const BufferHandle &buffer_handle, uint64_t offset, const void *data, uint64_t byte_size) = 0;
+
+        virtual void set_frame_count(uint32_t frame_count) = 0;
+        [[nodiscard]] virtual uint32_t frame_count() const = 0;
 
+        virtual void wait_for_frame(uint32_t frame_index) const = 0;
         virtual void begin_frame(SurfaceHandle surface_handle, uint32_t frame_index) = 0;
         virtual void end_frame() const = 0;
-        virtual void execute() const = 0;
+        // NOTE: Must be called exactly once per frame, it submits the uploads and signals the frame completion of every queue
+        virtual void execute(std::span<const SubmitDescriptor> submit_descriptors) const = 0;
         virtual void present(SurfaceHandle surface_handle) const = 0;
 
         virtual void wait_for_idle() const = 0;
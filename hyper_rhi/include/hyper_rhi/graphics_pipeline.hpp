@@ -11,6 +11,7 @@
 
 #include "hyper_rhi/pipeline_layout.hpp"
 #include "hyper_rhi/shader_module.hpp"
+#include "hyper_rhi/texture.hpp"
 
 namespace hyper_rhi
 {
@@ -21,6 +22,9 @@ namespace hyper_rhi
         PipelineLayoutHandle layout = nullptr;
         ShaderModuleHandle vertex_shader = nullptr;
         ShaderModuleHandle fragment_shader = nullptr;
+
+        TextureFormat color_attachment_format = TextureFormat::Unknown;
+        TextureFormat depth_attachment_format = TextureFormat::Unknown;
     };
 
     class GraphicsPipeline
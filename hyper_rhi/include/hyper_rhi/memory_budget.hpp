@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace hyper_rhi
+{
+    enum class MemoryCategory
+    {
+        Buffer,
+        Texture,
+
+        // NOTE: Memory heaps, which back the aliased transient resources of the render graph
+        Transient,
+    };
+
+    inline constexpr size_t g_memory_category_count = static_cast<size_t>(MemoryCategory::Transient) + 1;
+
+    struct MemoryHeapBudget
+    {
+        uint32_t heap_index = 0;
+        bool device_local = false;
+
+        // NOTE: Usage and budget cover the whole process, including memory allocated outside of the device
+        uint64_t usage = 0;
+        uint64_t budget = 0;
+        uint64_t peak_usage = 0;
+
+        uint64_t allocation_byte_size = 0;
+        uint32_t allocation_count = 0;
+    };
+
+    struct MemoryCategoryStatistics
+    {
+        uint32_t allocation_count = 0;
+        uint64_t byte_size = 0;
+    };
+
+    struct MemoryStatistics
+    {
+        std::vector<MemoryHeapBudget> heaps;
+        std::array<MemoryCategoryStatistics, g_memory_category_count> categories;
+    };
+
+    struct MemoryBudgetEvent
+    {
+        MemoryHeapBudget heap;
+        float threshold = 0.0f;
+
+        // NOTE: False when the usage fell back below the threshold, so streaming can resume
+        bool exceeded = false;
+    };
+
+    using MemoryBudgetCallback = std::function<void(const MemoryBudgetEvent &)>;
+
+    struct MemoryBudgetCallbackDescriptor
+    {
+        // NOTE: Fraction of the heap budget, the callback fires whenever a device local heap crosses it
+        float threshold = 0.9f;
+        MemoryBudgetCallback callback = nullptr;
+    };
+
+    // NOTE: Category counters are updated from any thread, heap budgets are polled once per frame by the device
+    class MemoryBudgetTracker
+    {
+    private:
+        struct Callback
+        {
+            float threshold;
+            MemoryBudgetCallback callback;
+            std::vector<bool> exceeded;
+        };
+
+    public:
+        MemoryBudgetTracker();
+
+        void track_allocation(MemoryCategory category, uint64_t byte_size);
+        void untrack_allocation(MemoryCategory category, uint64_t byte_size);
+
+        void add_callback(const MemoryBudgetCallbackDescriptor &descriptor);
+
+        void update(std::vector<MemoryHeapBudget> heaps);
+
+        [[nodiscard]] MemoryStatistics statistics() const;
+        void log_statistics() const;
+
+    private:
+        std::array<std::atomic<uint32_t>, g_memory_category_count> m_allocation_counts;
+        std::array<std::atomic<uint64_t>, g_memory_category_count> m_byte_sizes;
+
+        mutable std::mutex m_mutex;
+        std::vector<MemoryHeapBudget> m_heaps;
+        std::vector<Callback> m_callbacks;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace hyper_rhi
+{
+    struct MemoryRequirements
+    {
+        uint64_t byte_size = 0;
+        uint64_t alignment = 1;
+
+        // NOTE: Backend specific bitmask of the memory types the resource can be placed in
+        uint32_t memory_types = ~0u;
+    };
+
+    struct MemoryHeapDescriptor
+    {
+        std::string label;
+
+        MemoryRequirements requirements = {};
+    };
+
+    class MemoryHeap
+    {
+    public:
+        virtual ~MemoryHeap() = default;
+
+        [[nodiscard]] virtual uint64_t byte_size() const = 0;
+    };
+
+    using MemoryHeapHandle = std::shared_ptr<MemoryHeap>;
+} // namespace hyper_rhi
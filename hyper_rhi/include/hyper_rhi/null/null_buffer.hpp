@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "hyper_rhi/buffer.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullBuffer final : public Buffer
+    {
+    public:
+        NullBuffer(NullGraphicsDevice &graphics_device, const BufferDescriptor &descriptor);
+        ~NullBuffer() override;
+
+        [[nodiscard]] static MemoryRequirements memory_requirements(const BufferDescriptor &descriptor);
+
+    protected:
+        [[nodiscard]] uint64_t byte_size() const override;
+        [[nodiscard]] MemoryLocation memory_location() const override;
+        [[nodiscard]] uint8_t *mapped_data() const override;
+        [[nodiscard]] uint64_t device_address() const override;
+
+        [[nodiscard]] ResourceHandle handle() const override;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+
+        uint64_t m_byte_size;
+        MemoryLocation m_memory_location;
+
+        // NOTE: Only host visible buffers get memory, so the renderer can still write through the mapped pointer
+        std::unique_ptr<uint8_t[]> m_mapped_data;
+        MemoryHeapHandle m_memory_heap;
+        uint64_t m_allocation_byte_size;
+        uint64_t m_device_address;
+
+        ResourceHandle m_handle;
+    };
+} // namespace hyper_rhi
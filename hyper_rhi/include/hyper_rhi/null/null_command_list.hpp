@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "hyper_rhi/command_list.hpp"
+#include "hyper_rhi/null/null_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    class NullCommandList final : public CommandList
+    {
+    public:
+        NullCommandList(NullGraphicsDevice &graphics_device, const CommandListDescriptor &descriptor);
+        ~NullCommandList() override;
+
+        [[nodiscard]] bool recording() const;
+        [[nodiscard]] bool recorded() const;
+        [[nodiscard]] const NullStatistics &statistics() const;
+
+    protected:
+        [[nodiscard]] QueueType queue_type() const override;
+
+        void begin() override;
+        void end() override;
+
+        void barrier(std::span<const BufferBarrier> buffer_barriers, std::span<const TextureBarrier> texture_barriers) override;
+
+        void begin_gpu_scope(std::string_view name) override;
+        void end_gpu_scope() override;
+
+        void begin_render_pass(const RenderPassDescriptor &descriptor) override;
+        void end_render_pass() override;
+
+        void set_pipeline(const GraphicsPipelineHandle &pipeline) override;
+        void set_index_buffer(const BufferHandle &buffer) override;
+        void set_push_constants(const void *data, size_t byte_size) override;
+
+        void draw_indexed_indirect(const BufferHandle &argument_buffer, uint64_t argument_offset, uint32_t draw_count) override;
+        void draw_indexed_indirect_count(
+            const BufferHandle &argument_buffer,
+            uint64_t argument_offset,
+            const BufferHandle &count_buffer,
+            uint64_t count_offset,
+            uint32_t max_draw_count) override;
+
+    private:
+        void validate_recording(std::string_view command) const;
+        void validate_draw(std::string_view command, const BufferHandle &argument_buffer, uint64_t argument_offset, uint32_t draw_count) const;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+        QueueType m_queue_type;
+
+        bool m_recording;
+        bool m_recorded;
+        uint32_t m_gpu_scope_depth;
+
+        bool m_render_pass_active;
+        bool m_pipeline_bound;
+        bool m_index_buffer_bound;
+
+        NullStatistics m_statistics;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/compute_pipeline.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullComputePipeline final : public ComputePipeline
+    {
+    public:
+        NullComputePipeline(NullGraphicsDevice &graphics_device, const ComputePipelineDescriptor &descriptor);
+        ~NullComputePipeline() override;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+
+        // NOTE: Held like the other backends do, the pipeline cache keys on the layout address
+        PipelineLayoutHandle m_layout;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string_view>
+
+#include "hyper_rhi/descriptor_index_allocator.hpp"
+#include "hyper_rhi/graphics_device.hpp"
+#include "hyper_rhi/object_cache.hpp"
+
+namespace hyper_rhi
+{
+    enum class NullResourceType
+    {
+        Buffer,
+        CommandList,
+        ComputePipeline,
+        GraphicsPipeline,
+        MemoryHeap,
+        PipelineLayout,
+        ShaderModule,
+        Texture,
+        TextureView,
+    };
+
+    struct NullStatistics
+    {
+        uint64_t frame_count = 0;
+        uint64_t submit_count = 0;
+        uint64_t command_list_count = 0;
+        uint64_t barrier_batch_count = 0;
+        uint64_t buffer_barrier_count = 0;
+        uint64_t texture_barrier_count = 0;
+        uint64_t gpu_scope_count = 0;
+        uint64_t render_pass_count = 0;
+        uint64_t indirect_draw_count = 0;
+        uint64_t buffer_write_count = 0;
+        uint64_t buffer_write_byte_size = 0;
+        uint64_t validation_error_count = 0;
+    };
+
+    // NOTE: Implements every call as bookkeeping only, so the CPU side of the renderer can be measured without a driver
+    class NullGraphicsDevice final : public GraphicsDevice
+    {
+    public:
+        static constexpr size_t s_resource_type_count = 9;
+
+        // NOTE: Reported as the budget of the single device local heap the null device pretends to have
+        static constexpr uint64_t s_memory_budget = 8ull * 1024 * 1024 * 1024;
+
+    public:
+        explicit NullGraphicsDevice(const GraphicsDeviceDescriptor &descriptor);
+        ~NullGraphicsDevice() override;
+
+        [[nodiscard]] bool validation_enabled() const;
+        void report_validation_error(std::string_view message) const;
+
+        [[nodiscard]] DescriptorIndexAllocator &descriptor_index_allocator();
+        [[nodiscard]] MemoryBudgetTracker &memory_budget();
+
+        void track_resource(NullResourceType resource_type);
+        void untrack_resource(NullResourceType resource_type);
+
+        // NOTE: Command lists report their recorded commands on submission
+        void record_commands(const NullStatistics &command_statistics) const;
+
+        [[nodiscard]] NullStatistics statistics() const;
+
+    protected:
+        [[nodiscard]] GraphicsApi graphics_api() const override;
+        [[nodiscard]] bool buffer_device_address_supported() const override;
+        [[nodiscard]] bool draw_indirect_count_supported() const override;
+
+        SurfaceHandle create_surface(const SurfaceDescriptor &descriptor) override;
+
+        BufferHandle create_buffer(const BufferDescriptor &descriptor) override;
+        CommandListHandle create_command_list(const CommandListDescriptor &descriptor) override;
+        ComputePipelineHandle create_compute_pipeline(const ComputePipelineDescriptor &descriptor) override;
+        GraphicsPipelineHandle create_graphics_pipeline(const GraphicsPipelineDescriptor &descriptor) override;
+        MemoryHeapHandle create_memory_heap(const MemoryHeapDescriptor &descriptor) override;
+        PipelineLayoutHandle create_pipeline_layout(const PipelineLayoutDescriptor &descriptor) override;
+        ShaderModuleHandle create_shader_module(const ShaderModuleDescriptor &descriptor) override;
+        TextureHandle create_texture(const TextureDescriptor &descriptor) override;
+        TextureViewHandle create_texture_view(const TextureViewDescriptor &descriptor) override;
+
+        std::shared_future<ComputePipelineHandle> create_compute_pipeline_async(const ComputePipelineDescriptor &descriptor) override;
+        std::shared_future<GraphicsPipelineHandle> create_graphics_pipeline_async(const GraphicsPipelineDescriptor &descriptor) override;
+        void prewarm_pipelines(
+            std::span<const ComputePipelineDescriptor> compute_pipeline_descriptors,
+            std::span<const GraphicsPipelineDescriptor> graphics_pipeline_descriptors) override;
+
+        [[nodiscard]] MemoryRequirements buffer_memory_requirements(const BufferDescriptor &descriptor) const override;
+        [[nodiscard]] MemoryRequirements texture_memory_requirements(const TextureDescriptor &descriptor) const override;
+
+        [[nodiscard]] MemoryStatistics memory_statistics() const override;
+        void add_memory_budget_callback(const MemoryBudgetCallbackDescriptor &descriptor) override;
+
+        void write_buffer(const BufferHandle &buffer_handle, uint64_t offset, const void *data, uint64_t byte_size) override;
+
+        void set_frame_count(uint32_t frame_count) override;
+        [[nodiscard]] uint32_t frame_count() const override;
+
+        void wait_for_frame(uint32_t frame_index) const override;
+        void begin_frame(SurfaceHandle surface_handle, uint32_t frame_index) override;
+        void end_frame() const override;
+        void execute(std::span<const SubmitDescriptor> submit_descriptors) const override;
+        void present(SurfaceHandle surface_handle) const override;
+
+        void wait_for_idle() const override;
+
+    private:
+        [[nodiscard]] static std::string_view resource_type_name(NullResourceType resource_type);
+
+    private:
+        bool m_validation_enabled;
+
+        DescriptorIndexAllocator m_descriptor_index_allocator;
+        MemoryBudgetTracker m_memory_budget;
+
+        ObjectCache<ComputePipeline, ComputePipelineKey> m_compute_pipelines;
+        ObjectCache<GraphicsPipeline, GraphicsPipelineKey> m_graphics_pipelines;
+        std::array<std::atomic<int64_t>, s_resource_type_count> m_live_resource_counts;
+
+        mutable std::mutex m_statistics_mutex;
+        mutable NullStatistics m_statistics;
+
+        uint32_t m_frame_count;
+        uint32_t m_current_frame_index;
+        mutable bool m_frame_active;
+        mutable bool m_frame_executed;
+    };
+} // namespace hyper_rhi
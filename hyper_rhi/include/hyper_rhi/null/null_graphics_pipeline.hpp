@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/graphics_pipeline.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullGraphicsPipeline final : public GraphicsPipeline
+    {
+    public:
+        NullGraphicsPipeline(NullGraphicsDevice &graphics_device, const GraphicsPipelineDescriptor &descriptor);
+        ~NullGraphicsPipeline() override;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+
+        // NOTE: Held like the other backends do, the pipeline cache keys on the layout address
+        PipelineLayoutHandle m_layout;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/memory_heap.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullMemoryHeap final : public MemoryHeap
+    {
+    public:
+        NullMemoryHeap(NullGraphicsDevice &graphics_device, const MemoryHeapDescriptor &descriptor);
+        ~NullMemoryHeap() override;
+
+    protected:
+        [[nodiscard]] uint64_t byte_size() const override;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+
+        uint64_t m_byte_size;
+    };
+} // namespace hyper_rhi
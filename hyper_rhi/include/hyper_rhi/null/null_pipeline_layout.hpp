@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/pipeline_layout.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullPipelineLayout final : public PipelineLayout
+    {
+    public:
+        NullPipelineLayout(NullGraphicsDevice &graphics_device, const PipelineLayoutDescriptor &descriptor);
+        ~NullPipelineLayout() override;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/shader_module.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullShaderModule final : public ShaderModule
+    {
+    public:
+        NullShaderModule(NullGraphicsDevice &graphics_device, const ShaderModuleDescriptor &descriptor);
+        ~NullShaderModule() override;
+
+    protected:
+        [[nodiscard]] uint64_t hash() const override;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+
+        uint64_t m_hash;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "hyper_rhi/surface.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullSurface final : public Surface
+    {
+    public:
+        static constexpr uint32_t s_texture_count = 3;
+
+    public:
+        NullSurface(NullGraphicsDevice &graphics_device, const SurfaceDescriptor &descriptor);
+
+        // NOTE: Stands in for acquiring the next swapchain image
+        void acquire_next_texture();
+
+    protected:
+        void resize(uint32_t width, uint32_t height) override;
+
+        void set_present_mode(PresentMode present_mode) override;
+        [[nodiscard]] PresentMode present_mode() const override;
+
+        [[nodiscard]] TextureFormat format() const override;
+        [[nodiscard]] TextureHandle current_texture() const override;
+
+    private:
+        void create_textures();
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+
+        std::vector<TextureHandle> m_textures;
+        uint32_t m_current_texture_index;
+
+        uint32_t m_width;
+        uint32_t m_height;
+        PresentMode m_present_mode;
+    };
+} // namespace hyper_rhi
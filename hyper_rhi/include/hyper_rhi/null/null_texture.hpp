@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/texture.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullTexture final : public Texture
+    {
+    public:
+        NullTexture(NullGraphicsDevice &graphics_device, const TextureDescriptor &descriptor);
+        ~NullTexture() override;
+
+        [[nodiscard]] static MemoryRequirements memory_requirements(const TextureDescriptor &descriptor);
+
+        [[nodiscard]] TextureDimension dimension() const;
+        [[nodiscard]] uint32_t mip_levels() const;
+        [[nodiscard]] uint32_t array_layers() const;
+        [[nodiscard]] bool is_storage() const;
+
+    protected:
+        [[nodiscard]] TextureFormat format() const override;
+        [[nodiscard]] uint32_t width() const override;
+        [[nodiscard]] uint32_t height() const override;
+
+        [[nodiscard]] ResourceHandle handle() const override;
+        [[nodiscard]] ResourceHandle storage_handle() const override;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+
+        TextureFormat m_format;
+        uint32_t m_width;
+        uint32_t m_height;
+        TextureDimension m_dimension;
+        uint32_t m_mip_levels;
+        uint32_t m_array_layers;
+        bool m_is_storage;
+
+        MemoryHeapHandle m_memory_heap;
+        uint64_t m_allocation_byte_size;
+
+        ResourceHandle m_handle;
+        ResourceHandle m_storage_handle;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/texture_view.hpp"
+
+namespace hyper_rhi
+{
+    class NullGraphicsDevice;
+
+    class NullTextureView final : public TextureView
+    {
+    public:
+        NullTextureView(NullGraphicsDevice &graphics_device, const TextureViewDescriptor &descriptor);
+        ~NullTextureView() override;
+
+    protected:
+        [[nodiscard]] ResourceHandle handle() const override;
+        [[nodiscard]] ResourceHandle storage_handle() const override;
+
+    private:
+        NullGraphicsDevice &m_graphics_device;
+
+        TextureHandle m_texture;
+        bool m_is_storage;
+
+        ResourceHandle m_handle;
+        ResourceHandle m_storage_handle;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "hyper_rhi/compute_pipeline.hpp"
+#include "hyper_rhi/graphics_pipeline.hpp"
+#include "hyper_rhi/shader_module.hpp"
+
+namespace hyper_rhi
+{
+    struct ObjectCacheStatistics
+    {
+        uint64_t hit_count = 0;
+        uint64_t miss_count = 0;
+
+        // NOTE: Live entries and the references callers hold to them
+        size_t entry_count = 0;
+        size_t reference_count = 0;
+    };
+
+    // NOTE: Keys hold every field that identifies an object, so a hash collision never returns the wrong entry
+    struct ComputePipelineKey
+    {
+        const PipelineLayout *layout = nullptr;
+        uint64_t shader = 0;
+
+        bool operator==(const ComputePipelineKey &other) const = default;
+    };
+
+    struct GraphicsPipelineKey
+    {
+        const PipelineLayout *layout = nullptr;
+        uint64_t vertex_shader = 0;
+        uint64_t fragment_shader = 0;
+        TextureFormat color_attachment_format = TextureFormat::Unknown;
+        TextureFormat depth_attachment_format = TextureFormat::Unknown;
+
+        bool operator==(const GraphicsPipelineKey &other) const = default;
+    };
+
+    // NOTE: Labels are not part of the keys, a deduplicated object keeps the label it was created with
+    [[nodiscard]] uint64_t hash_descriptor(const ShaderModuleDescriptor &descriptor);
+    [[nodiscard]] ComputePipelineKey object_key(const ComputePipelineDescriptor &descriptor);
+    [[nodiscard]] GraphicsPipelineKey object_key(const GraphicsPipelineDescriptor &descriptor);
+    [[nodiscard]] uint64_t hash_key(const ComputePipelineKey &key);
+    [[nodiscard]] uint64_t hash_key(const GraphicsPipelineKey &key);
+
+    void log_statistics(std::string_view name, const ObjectCacheStatistics &statistics);
+
+    // NOTE: Entries are weak, the use count of the shared object is the refcount of its entry and the object dies with its last user
+    template <typename T, typename Key>
+    class ObjectCache
+    {
+    private:
+        static constexpr size_t s_shard_count = 16;
+
+        struct KeyHash
+        {
+            size_t operator()(const Key &key) const
+            {
+                return static_cast<size_t>(hash_key(key));
+            }
+        };
+
+        struct Shard
+        {
+            std::mutex mutex;
+            std::unordered_map<Key, std::weak_ptr<T>, KeyHash> entries;
+        };
+
+    public:
+        ObjectCache()
+            : m_shards()
+            , m_hit_count(0)
+            , m_miss_count(0)
+        {
+        }
+
+        ObjectCache(const ObjectCache &) = delete;
+        ObjectCache &operator=(const ObjectCache &) = delete;
+
+        // NOTE: Creation runs outside of the lock, when two threads race for the same key the first inserted object wins
+        template <typename Create>
+        [[nodiscard]] std::shared_ptr<T> get_or_create(const Key &key, Create &&create)
+        {
+            Shard &shard = m_shards[hash_key(key) % s_shard_count];
+
+            {
+                std::scoped_lock lock(shard.mutex);
+
+                const auto entry = shard.entries.find(key);
+                if (entry != shard.entries.end())
+                {
+                    if (std::shared_ptr<T> object = entry->second.lock())
+                    {
+                        m_hit_count.fetch_add(1, std::memory_order_relaxed);
+                        return object;
+                    }
+                }
+            }
+
+            std::shared_ptr<T> object = create();
+
+            std::scoped_lock lock(shard.mutex);
+
+            std::weak_ptr<T> &entry = shard.entries[key];
+            if (std::shared_ptr<T> existing_object = entry.lock())
+            {
+                m_hit_count.fetch_add(1, std::memory_order_relaxed);
+                return existing_object;
+            }
+
+            m_miss_count.fetch_add(1, std::memory_order_relaxed);
+
+            // NOTE: Misses are rare compared to the creation cost, so expired entries are dropped here instead of on release
+            std::erase_if(
+                shard.entries,
+                [](const auto &shard_entry)
+                {
+                    return shard_entry.second.expired();
+                });
+
+            shard.entries[key] = object;
+            return object;
+        }
+
+        [[nodiscard]] ObjectCacheStatistics statistics() const
+        {
+            ObjectCacheStatistics statistics = {
+                .hit_count = m_hit_count.load(std::memory_order_relaxed),
+                .miss_count = m_miss_count.load(std::memory_order_relaxed),
+                .entry_count = 0,
+                .reference_count = 0,
+            };
+
+            for (Shard &shard : m_shards)
+            {
+                std::scoped_lock lock(shard.mutex);
+                for (const auto &[key, entry] : shard.entries)
+                {
+                    const long use_count = entry.use_count();
+                    if (use_count == 0)
+                    {
+                        continue;
+                    }
+
+                    statistics.entry_count += 1;
+                    statistics.reference_count += static_cast<size_t>(use_count);
+                }
+            }
+
+            return statistics;
+        }
+
+    private:
+        mutable std::array<Shard, s_shard_count> m_shards;
+
+        std::atomic<uint64_t> m_hit_count;
+        std::atomic<uint64_t> m_miss_count;
+    };
+} // namespace hyper_rhi
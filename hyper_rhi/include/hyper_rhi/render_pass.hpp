@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
 
@@ -18,6 +19,7 @@ namespace hyper_rhi
         std::string label;
 
         std::shared_ptr<Texture> color_attachment = nullptr;
+        std::array<float, 4> clear_color = { 0.0f, 0.0f, 0.0f, 1.0f };
     };
 
     class RenderPass
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "hyper_rhi/graphics_device.hpp"
+#include "hyper_rhi/shader_module.hpp"
+
+namespace hyper_rhi
+{
+    struct ShaderCompilerDescriptor
+    {
+        std::string cache_directory = "./shader_cache";
+    };
+
+    struct ShaderCompilationDescriptor
+    {
+        GraphicsApi graphics_api = GraphicsApi::Vulkan;
+        std::string file_path;
+        ShaderType type = ShaderType::None;
+        std::string entry_name = "main";
+        std::vector<std::string> defines;
+    };
+
+    struct ShaderCompilationResult
+    {
+        std::vector<uint8_t> bytes;
+        std::vector<std::string> include_paths;
+        bool cached = false;
+    };
+
+    class ShaderCompiler
+    {
+    public:
+        explicit ShaderCompiler(const ShaderCompilerDescriptor &descriptor);
+
+        // NOTE: Thread safe, every compilation creates its own compiler instance
+        [[nodiscard]] std::optional<ShaderCompilationResult> compile(const ShaderCompilationDescriptor &descriptor) const;
+
+        [[nodiscard]] const std::string &cache_directory() const;
+
+    private:
+        [[nodiscard]] std::optional<ShaderCompilationResult> compile_source(
+            const ShaderCompilationDescriptor &descriptor,
+            const std::vector<uint8_t> &source) const;
+
+        [[nodiscard]] static std::optional<ShaderCompilationResult> load_cached(const std::string &cache_path, uint64_t source_hash);
+        static void store_cached(const std::string &cache_path, const ShaderCompilationResult &result, uint64_t source_hash);
+
+        [[nodiscard]] static uint64_t hash_content(uint64_t source_hash, const std::vector<std::string> &include_paths);
+
+    private:
+        std::string m_cache_directory;
+        uint64_t m_compiler_version;
+    };
+} // namespace hyper_rhi
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,6 +34,9 @@ namespace hyper_rhi
     {
     public:
         virtual ~ShaderModule() = default;
+
+        // NOTE: Hash of the type, entry and bytes, used to deduplicate pipelines built from identical shaders
+        [[nodiscard]] virtual uint64_t hash() const = 0;
     };
 
     using ShaderModuleHandle = std::shared_ptr<ShaderModule>;
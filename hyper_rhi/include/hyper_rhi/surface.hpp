@@ -14,9 +14,18 @@
 
 namespace hyper_rhi
 {
+    enum class PresentMode
+    {
+        Fifo,
+        FifoRelaxed,
+        Mailbox,
+        Immediate,
+    };
+
     struct SurfaceDescriptor
     {
         hyper_platform::Window &window;
+        PresentMode present_mode = PresentMode::Mailbox;
     };
 
     class Surface
@@ -26,6 +35,10 @@ namespace hyper_rhi
 
         virtual void resize(uint32_t width, uint32_t height) = 0;
 
+        virtual void set_present_mode(PresentMode present_mode) = 0;
+        [[nodiscard]] virtual PresentMode present_mode() const = 0;
+
+        [[nodiscard]] virtual TextureFormat format() const = 0;
         [[nodiscard]] virtual TextureHandle current_texture() const = 0;
     };
 
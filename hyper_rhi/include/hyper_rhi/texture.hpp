@@ -6,17 +6,257 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 
+#include "hyper_rhi/memory_heap.hpp"
+#include "hyper_rhi/resource_handle.hpp"
+
 namespace hyper_rhi
 {
     enum class TextureFormat
     {
         Unknown,
-        // TODO: Add more texture formats
+
+        R8Unorm,
+        R8Snorm,
+        R8Uint,
+        R8Sint,
+        R8G8Unorm,
+        R8G8Snorm,
+        R8G8Uint,
+        R8G8Sint,
+        R8G8B8A8Unorm,
+        R8G8B8A8Srgb,
+        R8G8B8A8Snorm,
+        R8G8B8A8Uint,
+        R8G8B8A8Sint,
+        B8G8R8A8Unorm,
+        B8G8R8A8Srgb,
+
+        R16Unorm,
+        R16Uint,
+        R16Sint,
+        R16Sfloat,
+        R16G16Unorm,
+        R16G16Uint,
+        R16G16Sint,
+        R16G16Sfloat,
+        R16G16B16A16Unorm,
+        R16G16B16A16Uint,
+        R16G16B16A16Sint,
+        R16G16B16A16Sfloat,
+
+        R32Uint,
+        R32Sint,
+        R32Sfloat,
+        R32G32Uint,
+        R32G32Sint,
+        R32G32Sfloat,
+        R32G32B32A32Uint,
+        R32G32B32A32Sint,
+        R32G32B32A32Sfloat,
+
+        A2B10G10R10Unorm,
+        B10G11R11Ufloat,
+        E5B9G9R9Ufloat,
+
+        D16Unorm,
+        D32Sfloat,
+        D24UnormS8Uint,
+        D32SfloatS8Uint,
+
+        Bc1Unorm,
+        Bc1Srgb,
+        Bc2Unorm,
+        Bc2Srgb,
+        Bc3Unorm,
+        Bc3Srgb,
+        Bc4Unorm,
+        Bc4Snorm,
+        Bc5Unorm,
+        Bc5Snorm,
+        Bc6hUfloat,
+        Bc6hSfloat,
+        Bc7Unorm,
+        Bc7Srgb,
+
+        Astc4x4Unorm,
+        Astc4x4Srgb,
+        Astc5x5Unorm,
+        Astc5x5Srgb,
+        Astc6x6Unorm,
+        Astc6x6Srgb,
+        Astc8x8Unorm,
+        Astc8x8Srgb,
+        Astc10x10Unorm,
+        Astc10x10Srgb,
+        Astc12x12Unorm,
+        Astc12x12Srgb,
+    };
+
+    enum class TextureAspect
+    {
+        None,
+        Color,
+        Depth,
+        DepthStencil,
     };
 
+    // NOTE: Uncompressed formats are single texel blocks, so the same math sizes compressed and uncompressed textures
+    struct TextureFormatInfo
+    {
+        TextureFormat format = TextureFormat::Unknown;
+        uint32_t block_width = 0;
+        uint32_t block_height = 0;
+        uint32_t bytes_per_block = 0;
+        TextureAspect aspect = TextureAspect::None;
+    };
+
+    inline constexpr size_t g_texture_format_count = static_cast<size_t>(TextureFormat::Astc12x12Srgb) + 1;
+
+    inline constexpr std::array<TextureFormatInfo, g_texture_format_count> g_texture_format_infos = {
+        TextureFormatInfo{ TextureFormat::Unknown, 0, 0, 0, TextureAspect::None },
+        TextureFormatInfo{ TextureFormat::R8Unorm, 1, 1, 1, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8Snorm, 1, 1, 1, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8Uint, 1, 1, 1, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8Sint, 1, 1, 1, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8Unorm, 1, 1, 2, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8Snorm, 1, 1, 2, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8Uint, 1, 1, 2, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8Sint, 1, 1, 2, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8B8A8Unorm, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8B8A8Srgb, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8B8A8Snorm, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8B8A8Uint, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R8G8B8A8Sint, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::B8G8R8A8Unorm, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::B8G8R8A8Srgb, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16Unorm, 1, 1, 2, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16Uint, 1, 1, 2, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16Sint, 1, 1, 2, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16Sfloat, 1, 1, 2, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16G16Unorm, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16G16Uint, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16G16Sint, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16G16Sfloat, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16G16B16A16Unorm, 1, 1, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16G16B16A16Uint, 1, 1, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16G16B16A16Sint, 1, 1, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R16G16B16A16Sfloat, 1, 1, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32Uint, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32Sint, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32Sfloat, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32G32Uint, 1, 1, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32G32Sint, 1, 1, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32G32Sfloat, 1, 1, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32G32B32A32Uint, 1, 1, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32G32B32A32Sint, 1, 1, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::R32G32B32A32Sfloat, 1, 1, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::A2B10G10R10Unorm, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::B10G11R11Ufloat, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::E5B9G9R9Ufloat, 1, 1, 4, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::D16Unorm, 1, 1, 2, TextureAspect::Depth },
+        TextureFormatInfo{ TextureFormat::D32Sfloat, 1, 1, 4, TextureAspect::Depth },
+        TextureFormatInfo{ TextureFormat::D24UnormS8Uint, 1, 1, 4, TextureAspect::DepthStencil },
+        TextureFormatInfo{ TextureFormat::D32SfloatS8Uint, 1, 1, 8, TextureAspect::DepthStencil },
+        TextureFormatInfo{ TextureFormat::Bc1Unorm, 4, 4, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc1Srgb, 4, 4, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc2Unorm, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc2Srgb, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc3Unorm, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc3Srgb, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc4Unorm, 4, 4, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc4Snorm, 4, 4, 8, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc5Unorm, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc5Snorm, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc6hUfloat, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc6hSfloat, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc7Unorm, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Bc7Srgb, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc4x4Unorm, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc4x4Srgb, 4, 4, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc5x5Unorm, 5, 5, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc5x5Srgb, 5, 5, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc6x6Unorm, 6, 6, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc6x6Srgb, 6, 6, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc8x8Unorm, 8, 8, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc8x8Srgb, 8, 8, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc10x10Unorm, 10, 10, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc10x10Srgb, 10, 10, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc12x12Unorm, 12, 12, 16, TextureAspect::Color },
+        TextureFormatInfo{ TextureFormat::Astc12x12Srgb, 12, 12, 16, TextureAspect::Color },
+    };
+
+    [[nodiscard]] constexpr bool validate_texture_format_infos()
+    {
+        for (size_t format = 0; format < g_texture_format_infos.size(); ++format)
+        {
+            if (static_cast<size_t>(g_texture_format_infos[format].format) != format)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(validate_texture_format_infos(), "Texture format infos have to be in the order of the format enum");
+
+    [[nodiscard]] constexpr const TextureFormatInfo &texture_format_info(const TextureFormat format)
+    {
+        return g_texture_format_infos[static_cast<size_t>(format)];
+    }
+
+    [[nodiscard]] constexpr bool texture_format_compressed(const TextureFormat format)
+    {
+        return texture_format_info(format).block_width > 1;
+    }
+
+    // NOTE: Tightly packed size of the texel data, drivers may add padding on top of it
+    [[nodiscard]] constexpr uint64_t texture_mip_byte_size(
+        const TextureFormat format,
+        const uint32_t width,
+        const uint32_t height,
+        const uint32_t depth,
+        const uint32_t mip_level)
+    {
+        const TextureFormatInfo &format_info = texture_format_info(format);
+
+        const uint64_t mip_width = std::max(width >> mip_level, 1u);
+        const uint64_t mip_height = std::max(height >> mip_level, 1u);
+        const uint64_t mip_depth = std::max(depth >> mip_level, 1u);
+
+        const uint64_t block_count_x = (mip_width + format_info.block_width - 1) / format_info.block_width;
+        const uint64_t block_count_y = (mip_height + format_info.block_height - 1) / format_info.block_height;
+
+        return block_count_x * block_count_y * mip_depth * format_info.bytes_per_block;
+    }
+
+    [[nodiscard]] constexpr uint64_t texture_byte_size(
+        const TextureFormat format,
+        const uint32_t width,
+        const uint32_t height,
+        const uint32_t depth,
+        const uint32_t array_size,
+        const uint32_t mip_levels)
+    {
+        uint64_t byte_size = 0;
+        for (uint32_t mip_level = 0; mip_level < mip_levels; ++mip_level)
+        {
+            byte_size += texture_mip_byte_size(format, width, height, depth, mip_level);
+        }
+
+        return byte_size * array_size;
+    }
+
+    static_assert(texture_byte_size(TextureFormat::R8G8B8A8Unorm, 4, 4, 1, 1, 3) == (16 + 4 + 1) * 4);
+    static_assert(texture_byte_size(TextureFormat::Bc7Unorm, 1024, 1024, 1, 1, 1) == 1024 * 1024);
+    static_assert(texture_byte_size(TextureFormat::Astc6x6Srgb, 1920, 1080, 1, 2, 1) == 320 * 180 * 16 * 2);
+
     enum class TextureDimension
     {
         Unknown,
@@ -40,12 +280,42 @@ namespace hyper_rhi
         uint32_t sample_quality = 0;
         TextureFormat format = TextureFormat::Unknown;
         TextureDimension dimension = TextureDimension::Unknown;
+        bool is_render_attachment = false;
+        bool is_storage = false;
+
+        // NOTE: Placed textures alias the heap memory at the given offset instead of owning an allocation
+        MemoryHeapHandle memory_heap = nullptr;
+        uint64_t memory_heap_offset = 0;
+
+        bool operator==(const TextureDescriptor &other) const = default;
     };
 
+    [[nodiscard]] constexpr uint64_t texture_byte_size(const TextureDescriptor &descriptor)
+    {
+        const bool is_volume = descriptor.dimension == TextureDimension::Texture3D;
+
+        return texture_byte_size(
+                   descriptor.format,
+                   descriptor.width,
+                   descriptor.height,
+                   is_volume ? descriptor.depth : 1,
+                   is_volume ? 1 : descriptor.array_size,
+                   descriptor.mip_levels) *
+               descriptor.sample_count;
+    }
+
+    // NOTE: Sampled textures are registered in the bindless heaps, storage textures additionally in the storage heap
     class Texture
     {
     public:
         virtual ~Texture() = default;
+
+        [[nodiscard]] virtual TextureFormat format() const = 0;
+        [[nodiscard]] virtual uint32_t width() const = 0;
+        [[nodiscard]] virtual uint32_t height() const = 0;
+
+        [[nodiscard]] virtual ResourceHandle handle() const = 0;
+        [[nodiscard]] virtual ResourceHandle storage_handle() const = 0;
     };
 
     using TextureHandle = std::shared_ptr<Texture>;
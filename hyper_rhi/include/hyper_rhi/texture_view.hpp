@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "hyper_rhi/resource_handle.hpp"
+#include "hyper_rhi/texture.hpp"
+
+namespace hyper_rhi
+{
+    struct TextureViewDescriptor
+    {
+        std::string label;
+
+        TextureHandle texture = nullptr;
+
+        // NOTE: An unknown dimension keeps the dimension of the texture
+        TextureDimension dimension = TextureDimension::Unknown;
+        uint32_t base_mip_level = 0;
+        uint32_t mip_level_count = 1;
+        uint32_t base_array_layer = 0;
+        uint32_t array_layer_count = 1;
+    };
+
+    // NOTE: Views register in the same bindless heaps as their texture, a view of a single mip can be written as storage
+    class TextureView
+    {
+    public:
+        virtual ~TextureView() = default;
+
+        [[nodiscard]] virtual ResourceHandle handle() const = 0;
+        [[nodiscard]] virtual ResourceHandle storage_handle() const = 0;
+    };
+
+    using TextureViewHandle = std::shared_ptr<TextureView>;
+} // namespace hyper_rhi
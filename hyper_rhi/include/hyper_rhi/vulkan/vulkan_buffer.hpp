@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/buffer.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+#include <vk_mem_alloc.h>
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanBuffer final : public Buffer
+    {
+    public:
+        VulkanBuffer(VulkanGraphicsDevice &graphics_device, const BufferDescriptor &descriptor);
+        ~VulkanBuffer() override;
+
+        [[nodiscard]] static MemoryRequirements memory_requirements(const VulkanGraphicsDevice &graphics_device, const BufferDescriptor &descriptor);
+
+        [[nodiscard]] VkBuffer buffer() const;
+        [[nodiscard]] VmaAllocation allocation() const;
+
+    protected:
+        [[nodiscard]] uint64_t byte_size() const override;
+        [[nodiscard]] MemoryLocation memory_location() const override;
+        [[nodiscard]] uint8_t *mapped_data() const override;
+        [[nodiscard]] uint64_t device_address() const override;
+
+        [[nodiscard]] ResourceHandle handle() const override;
+
+    private:
+        static VkBufferCreateInfo buffer_create_info(const VulkanGraphicsDevice &graphics_device, const BufferDescriptor &descriptor);
+        static VmaAllocationCreateInfo allocation_create_info(MemoryLocation memory_location);
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        uint64_t m_byte_size;
+        MemoryLocation m_memory_location;
+
+        VkBuffer m_buffer;
+        VmaAllocation m_allocation;
+        MemoryHeapHandle m_memory_heap;
+        uint8_t *m_mapped_data;
+        VkDeviceAddress m_device_address;
+
+        ResourceHandle m_handle;
+    };
+} // namespace hyper_rhi
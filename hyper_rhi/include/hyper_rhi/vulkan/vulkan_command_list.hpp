@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <vector>
+
 #include "hyper_rhi/command_list.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+#include "hyper_rhi/vulkan/vulkan_gpu_profiler.hpp"
 
 namespace hyper_rhi
 {
@@ -15,13 +19,43 @@ namespace hyper_rhi
     class VulkanCommandList : public CommandList
     {
     public:
-        explicit VulkanCommandList(VulkanGraphicsDevice &graphics_device);
+        VulkanCommandList(VulkanGraphicsDevice &graphics_device, const CommandListDescriptor &descriptor);
+
+        [[nodiscard]] VkCommandBuffer command_buffer() const;
 
     protected:
-        void begin() const override;
-        void end() const override;
+        [[nodiscard]] QueueType queue_type() const override;
+
+        void begin() override;
+        void end() override;
+
+        void barrier(std::span<const BufferBarrier> buffer_barriers, std::span<const TextureBarrier> texture_barriers) override;
+
+        void begin_gpu_scope(std::string_view name) override;
+        void end_gpu_scope() override;
+
+        void begin_render_pass(const RenderPassDescriptor &descriptor) override;
+        void end_render_pass() override;
+
+        void set_pipeline(const GraphicsPipelineHandle &pipeline) override;
+        void set_index_buffer(const BufferHandle &buffer) override;
+        void set_push_constants(const void *data, size_t byte_size) override;
+
+        void draw_indexed_indirect(const BufferHandle &argument_buffer, uint64_t argument_offset, uint32_t draw_count) override;
+        void draw_indexed_indirect_count(
+            const BufferHandle &argument_buffer,
+            uint64_t argument_offset,
+            const BufferHandle &count_buffer,
+            uint64_t count_offset,
+            uint32_t max_draw_count) override;
 
     private:
         VulkanGraphicsDevice &m_graphics_device;
+        QueueType m_queue_type;
+
+        VkCommandBuffer m_command_buffer;
+        VkPipelineLayout m_pipeline_layout;
+
+        std::vector<VulkanGpuProfiler::ScopeQueries> m_gpu_scopes;
     };
 } // namespace hyper_rhi
\ No newline at end of file
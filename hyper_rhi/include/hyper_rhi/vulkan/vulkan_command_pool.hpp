@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    // NOTE: Owned by exactly one recording thread and one frame slot, so no synchronization is needed
+    class VulkanCommandPool
+    {
+    public:
+        VulkanCommandPool(VulkanGraphicsDevice &graphics_device, uint32_t queue_family_index);
+        ~VulkanCommandPool();
+
+        VulkanCommandPool(const VulkanCommandPool &) = delete;
+        VulkanCommandPool &operator=(const VulkanCommandPool &) = delete;
+
+        [[nodiscard]] VkCommandBuffer acquire();
+        void reset();
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        VkCommandPool m_command_pool;
+        std::vector<VkCommandBuffer> m_command_buffers;
+        size_t m_used_command_buffers;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include <hyper_core/mpsc_queue.hpp>
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanDeletionQueue
+    {
+    private:
+        struct Deletion
+        {
+            uint64_t timeline_value;
+            std::function<void()> deleter;
+        };
+
+    public:
+        explicit VulkanDeletionQueue(VulkanGraphicsDevice &graphics_device);
+        ~VulkanDeletionQueue();
+
+        void enqueue(std::function<void()> deleter);
+
+        void flush(uint64_t completed_timeline_value);
+        void flush_all();
+
+    private:
+        void collect();
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        hyper_core::MpscQueue<Deletion> m_deletions;
+        std::vector<Deletion> m_pending_deletions;
+    };
+} // namespace hyper_rhi
@@ -7,17 +7,47 @@
 #pragma once
 
 #include <array>
-#include <stack>
+#include <memory>
+#include <vector>
 
+#include <hyper_core/mpsc_queue.hpp>
+
+#include "hyper_rhi/command_list.hpp"
+#include "hyper_rhi/descriptor_index_allocator.hpp"
 #include "hyper_rhi/resource_handle.hpp"
 #include "hyper_rhi/vulkan/vulkan_common.hpp"
 
+#include <vk_mem_alloc.h>
+
 namespace hyper_rhi
 {
     class VulkanGraphicsDevice;
 
+    enum class DescriptorHeapType : uint8_t
+    {
+        StorageBuffer,
+        SampledImage,
+        StorageImage,
+    };
+
     class VulkanDescriptorManager
     {
+    private:
+        struct PendingWrite
+        {
+            DescriptorHeapType heap_type;
+            uint32_t index;
+            VkDescriptorBufferInfo buffer_info;
+            VkDescriptorImageInfo image_info;
+        };
+
+        struct RetiredHandle
+        {
+            DescriptorHeapType heap_type;
+            uint32_t index;
+            uint64_t timeline_value;
+        };
+
     private:
         static constexpr std::array<VkDescriptorType, 3> s_descriptor_types = {
             VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
@@ -25,26 +55,72 @@ namespace hyper_rhi
             VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
         };
 
+    public:
+        // NOTE: Every pipeline layout shares this push constant range, which keeps the bindless sets compatible between pipelines
+        static constexpr uint32_t s_push_constant_size = 128;
+
     public:
         explicit VulkanDescriptorManager(VulkanGraphicsDevice &graphics_device);
         ~VulkanDescriptorManager();
 
+        [[nodiscard]] const std::array<VkDescriptorSetLayout, s_descriptor_types.size()> &descriptor_set_layouts() const;
+        [[nodiscard]] VkPipelineCreateFlags pipeline_create_flags() const;
+
+        [[nodiscard]] ResourceHandle allocate_buffer_handle(VkBuffer buffer, VkDeviceSize byte_size);
+        [[nodiscard]] ResourceHandle allocate_image_handle(DescriptorHeapType heap_type, VkImageView image_view);
+        void retire_handle(DescriptorHeapType heap_type, const ResourceHandle &handle);
+
+        void recycle(uint64_t completed_timeline_value);
+        void flush_writes();
+
+        void bind(VkCommandBuffer command_buffer, QueueType queue_type) const;
+
     private:
         void find_descriptor_counts();
         void create_descriptor_pool();
         void create_descriptor_set_layouts();
         void create_descriptor_sets();
+        void create_descriptor_buffer();
+        void create_pipeline_layout();
+
+        void write_descriptor(DescriptorHeapType heap_type, uint32_t index, const VkDescriptorGetInfoEXT &descriptor_get_info) const;
+
+        DescriptorIndexAllocator &index_allocator(DescriptorHeapType heap_type) const;
 
     private:
         VulkanGraphicsDevice &m_graphics_device;
 
+        // NOTE: Descriptor buffers replace the pool and sets when the device supports them
+        bool m_descriptor_buffer_enabled;
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT m_descriptor_buffer_properties;
+
         std::array<uint32_t, s_descriptor_types.size()> m_descriptor_counts;
+        std::array<size_t, s_descriptor_types.size()> m_descriptor_sizes;
 
-        VkDescriptorPool m_descriptor_pool;
         std::array<VkDescriptorSetLayout, s_descriptor_types.size()> m_descriptor_set_layouts;
+        VkPipelineLayout m_pipeline_layout;
+
+        VkDescriptorPool m_descriptor_pool;
         std::array<VkDescriptorSet, s_descriptor_types.size()> m_descriptor_sets;
 
-        std::stack<ResourceHandle> m_recycled_descriptors;
-        uint32_t m_current_index;
+        VkBuffer m_descriptor_buffer;
+        VmaAllocation m_descriptor_buffer_allocation;
+        uint8_t *m_descriptor_buffer_data;
+        VkDeviceAddress m_descriptor_buffer_address;
+        std::array<VkDeviceSize, s_descriptor_types.size()> m_descriptor_set_offsets;
+        std::array<VkDeviceSize, s_descriptor_types.size()> m_descriptor_binding_offsets;
+
+        std::array<std::unique_ptr<DescriptorIndexAllocator>, s_descriptor_types.size()> m_index_allocators;
+
+        // NOTE: Retired indices return to their heap once the GPU has passed the frame that retired them
+        hyper_core::MpscQueue<RetiredHandle> m_retired_handles;
+        std::vector<RetiredHandle> m_pending_retired_handles;
+
+        // NOTE: Writes are collected from any thread and applied with a single update on the render thread
+        hyper_core::MpscQueue<PendingWrite> m_pending_writes;
+        std::vector<PendingWrite> m_flushed_writes;
+        std::vector<VkDescriptorBufferInfo> m_buffer_infos;
+        std::vector<VkDescriptorImageInfo> m_image_infos;
+        std::vector<VkWriteDescriptorSet> m_write_descriptor_sets;
     };
 } // namespace hyper_rhi
\ No newline at end of file
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <array>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "hyper_rhi/command_list.hpp"
+#include "hyper_rhi/graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanGpuProfiler
+    {
+    public:
+        static constexpr uint32_t s_invalid_query = std::numeric_limits<uint32_t>::max();
+
+        struct ScopeQueries
+        {
+            uint32_t frame_slot = 0;
+            uint32_t scope = s_invalid_query;
+            uint32_t statistics_query = s_invalid_query;
+        };
+
+    private:
+        static constexpr uint32_t s_max_scope_count = 256;
+
+        struct Scope
+        {
+            std::string name;
+            QueueType queue_type;
+            uint32_t depth;
+            uint32_t statistics_query;
+        };
+
+        struct FrameQueries
+        {
+            VkQueryPool timestamp_query_pool;
+            VkQueryPool statistics_query_pool;
+
+            uint64_t frame_index;
+            std::vector<Scope> scopes;
+            uint32_t statistics_query_count;
+        };
+
+    public:
+        VulkanGpuProfiler(VulkanGraphicsDevice &graphics_device, bool pipeline_statistics_supported, float timestamp_period);
+        ~VulkanGpuProfiler();
+
+        // NOTE: Reads back the results of the frame that used the slot before, the device has already waited for it
+        void begin_frame(uint64_t frame_index);
+
+        [[nodiscard]] ScopeQueries begin_scope(VkCommandBuffer command_buffer, QueueType queue_type, std::string_view name, uint32_t depth);
+        void end_scope(VkCommandBuffer command_buffer, const ScopeQueries &scope_queries);
+
+    private:
+        void resolve(FrameQueries &frame) const;
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+        bool m_pipeline_statistics_supported;
+        float m_timestamp_period;
+        std::array<bool, GraphicsDevice::s_queue_type_count> m_timestamps_supported;
+
+        std::array<FrameQueries, GraphicsDevice::s_max_frame_count> m_frames;
+        uint32_t m_current_frame_slot;
+
+        std::mutex m_mutex;
+    };
+} // namespace hyper_rhi
@@ -7,12 +7,26 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "hyper_rhi/graphics_device.hpp"
+#include "hyper_rhi/object_cache.hpp"
+#include "hyper_rhi/vulkan/vulkan_command_pool.hpp"
 #include "hyper_rhi/vulkan/vulkan_common.hpp"
+#include "hyper_rhi/vulkan/vulkan_deletion_queue.hpp"
 #include "hyper_rhi/vulkan/vulkan_descriptor_manager.hpp"
+#include "hyper_rhi/vulkan/vulkan_gpu_profiler.hpp"
+#include "hyper_rhi/vulkan/vulkan_pipeline_cache.hpp"
+#include "hyper_rhi/vulkan/vulkan_staging_ring.hpp"
 
 #include <vk_mem_alloc.h>
 
@@ -21,15 +35,61 @@ namespace hyper_rhi
     class VulkanGraphicsDevice final : public GraphicsDevice
     {
     public:
+        // NOTE: A frame signals frame_index << shift, the values in between belong to the uploads and explicit points of that frame
+        static constexpr uint32_t s_timeline_frame_shift = 16;
+
+        struct QueueFamilies
+        {
+            uint32_t graphics;
+            uint32_t compute;
+            uint32_t transfer;
+        };
+
+        struct PhysicalDeviceCapabilities
+        {
+            uint32_t index;
+            std::string name;
+            VkPhysicalDeviceType type;
+            uint32_t api_version;
+            uint64_t device_local_memory;
+            bool async_compute;
+            bool async_transfer;
+            uint32_t subgroup_size;
+            bool pipeline_statistics;
+            bool shader_int64;
+            bool memory_budget;
+            bool descriptor_buffer;
+            bool draw_indirect_count;
+        };
+
+        // NOTE: Every queue signals its timeline semaphore once per frame with the shifted index of that frame
+        struct QueueData
+        {
+            VkQueue queue;
+            uint32_t family_index;
+            VkSemaphore timeline_semaphore;
+        };
+
         struct FrameData
         {
-            VkCommandPool command_pool;
-            VkCommandBuffer command_buffer;
+            VkCommandPool upload_command_pool;
+            VkCommandBuffer upload_command_buffer;
 
             VkSemaphore render_semaphore;
             VkSemaphore present_semaphore;
         };
 
+        struct SubmitBatch
+        {
+            std::vector<VkSemaphoreSubmitInfo> wait_semaphore_submit_infos;
+            std::vector<VkCommandBufferSubmitInfo> command_buffer_submit_infos;
+            std::vector<VkSemaphoreSubmitInfo> signal_semaphore_submit_infos;
+        };
+
+        // NOTE: Every recording thread owns one pool per frame slot and queue
+        using ThreadCommandPools =
+            std::array<std::array<std::unique_ptr<VulkanCommandPool>, GraphicsDevice::s_queue_type_count>, GraphicsDevice::s_max_frame_count>;
+
     public:
         explicit VulkanGraphicsDevice(const GraphicsDeviceDescriptor &descriptor);
         ~VulkanGraphicsDevice() override;
@@ -37,23 +97,66 @@ namespace hyper_rhi
         [[nodiscard]] VkInstance instance() const;
         [[nodiscard]] VkPhysicalDevice physical_device() const;
         [[nodiscard]] VkDevice device() const;
+        [[nodiscard]] bool descriptor_buffer_supported() const;
+        [[nodiscard]] VmaAllocator allocator() const;
+        [[nodiscard]] VulkanDescriptorManager &descriptor_manager() const;
+        [[nodiscard]] VulkanDeletionQueue &deletion_queue() const;
+        [[nodiscard]] VulkanGpuProfiler &gpu_profiler() const;
+        [[nodiscard]] MemoryBudgetTracker &memory_budget();
+        [[nodiscard]] VulkanPipelineCache &pipeline_cache() const;
+
+        [[nodiscard]] const QueueData &queue(QueueType queue_type) const;
+        [[nodiscard]] const std::vector<uint32_t> &queue_family_indices() const;
 
         const FrameData &current_frame() const;
+        [[nodiscard]] uint32_t current_frame_index() const;
+        [[nodiscard]] uint64_t retire_timeline_value() const;
+
+        [[nodiscard]] VulkanCommandPool &command_pool(QueueType queue_type);
+
+        void set_object_name(VkObjectType object_type, uint64_t object_handle, std::string_view name) const;
+
+        // NOTE: Waits until every queue finished the given frame, the graphics queue completes a frame only after the other queues
+        void wait_for_timeline_value(uint64_t value) const;
 
     protected:
+        [[nodiscard]] GraphicsApi graphics_api() const override;
+        [[nodiscard]] bool buffer_device_address_supported() const override;
+        [[nodiscard]] bool draw_indirect_count_supported() const override;
+
         SurfaceHandle create_surface(const SurfaceDescriptor &descriptor) override;
 
         BufferHandle create_buffer(const BufferDescriptor &descriptor) override;
-        CommandListHandle create_command_list() override;
+        CommandListHandle create_command_list(const CommandListDescriptor &descriptor) override;
         ComputePipelineHandle create_compute_pipeline(const ComputePipelineDescriptor &descriptor) override;
         GraphicsPipelineHandle create_graphics_pipeline(const GraphicsPipelineDescriptor &descriptor) override;
+        MemoryHeapHandle create_memory_heap(const MemoryHeapDescriptor &descriptor) override;
         PipelineLayoutHandle create_pipeline_layout(const PipelineLayoutDescriptor &descriptor) override;
         ShaderModuleHandle create_shader_module(const ShaderModuleDescriptor &descriptor) override;
         TextureHandle create_texture(const TextureDescriptor &descriptor) override;
+        TextureViewHandle create_texture_view(const TextureViewDescriptor &descriptor) override;
+
+        std::shared_future<ComputePipelineHandle> create_compute_pipeline_async(const ComputePipelineDescriptor &descriptor) override;
+        std::shared_future<GraphicsPipelineHandle> create_graphics_pipeline_async(const GraphicsPipelineDescriptor &descriptor) override;
+        void prewarm_pipelines(
+            std::span<const ComputePipelineDescriptor> compute_pipeline_descriptors,
+            std::span<const GraphicsPipelineDescriptor> graphics_pipeline_descriptors) override;
+
+        [[nodiscard]] MemoryRequirements buffer_memory_requirements(const BufferDescriptor &descriptor) const override;
+        [[nodiscard]] MemoryRequirements texture_memory_requirements(const TextureDescriptor &descriptor) const override;
+
+        [[nodiscard]] MemoryStatistics memory_statistics() const override;
+        void add_memory_budget_callback(const MemoryBudgetCallbackDescriptor &descriptor) override;
+
+        void write_buffer(const BufferHandle &buffer_handle, uint64_t offset, const void *data, uint64_t byte_size) override;
+
+        void set_frame_count(uint32_t frame_count) override;
+        [[nodiscard]] uint32_t frame_count() const override;
 
+        void wait_for_frame(uint32_t frame_index) const override;
         void begin_frame(SurfaceHandle surface_handle, uint32_t frame_index) override;
         void end_frame() const override;
-        void execute() const override;
+        void execute(std::span<const SubmitDescriptor> submit_descriptors) const override;
         void present(SurfaceHandle surface_handle) const override;
         void wait_for_idle() const override;
 
@@ -62,17 +165,31 @@ namespace hyper_rhi
         void create_instance();
         void create_debug_messenger();
 
-        void choose_physical_device();
-        uint32_t rate_physical_device(const VkPhysicalDevice &physical_device) const;
-        std::optional<uint32_t> find_queue_family(const VkPhysicalDevice &physical_device) const;
+        void choose_physical_device(std::string_view adapter);
+        std::optional<PhysicalDeviceCapabilities> query_capabilities(const VkPhysicalDevice &physical_device, uint32_t index) const;
+        static uint32_t rate_physical_device(const PhysicalDeviceCapabilities &capabilities);
+        std::optional<QueueFamilies> find_queue_families(const VkPhysicalDevice &physical_device) const;
         static bool check_extension_support(const VkPhysicalDevice &physical_device);
         static bool check_feature_support(const VkPhysicalDevice &physical_device);
+        static bool check_pipeline_statistics_support(const VkPhysicalDevice &physical_device);
+        static bool check_shader_int64_support(const VkPhysicalDevice &physical_device);
+        static bool check_device_extension_support(const VkPhysicalDevice &physical_device, std::string_view extension_name);
+        static bool check_descriptor_buffer_support(const VkPhysicalDevice &physical_device);
 
         void create_device();
         void create_allocator();
 
+        void create_timeline_semaphores();
         void create_frames();
 
+        void update_memory_budget();
+
+        [[nodiscard]] VkSemaphoreSubmitInfo timeline_submit_info(QueueType queue_type, uint64_t value, VkPipelineStageFlags2 stage_mask) const;
+        [[nodiscard]] uint64_t frame_timeline_value(uint64_t frame_local_value) const;
+
+        void submit(QueueType queue_type, std::span<const SubmitBatch> submit_batches) const;
+        void submit_queues(const std::array<std::vector<SubmitBatch>, GraphicsDevice::s_queue_type_count> &queue_submit_batches) const;
+
         static VKAPI_ATTR VkBool32 VKAPI_CALL debug_callback(
             VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
             VkDebugUtilsMessageTypeFlagsEXT message_type,
@@ -84,16 +201,42 @@ namespace hyper_rhi
         VkInstance m_instance;
         VkDebugUtilsMessengerEXT m_debug_messenger;
         VkPhysicalDevice m_physical_device;
+        VkDeviceSize m_buffer_image_granularity;
+        float m_timestamp_period;
+        bool m_pipeline_statistics_supported;
+        bool m_shader_int64_supported;
+        bool m_memory_budget_supported;
+        bool m_descriptor_buffer_supported;
+        bool m_draw_indirect_count_supported;
         VkDevice m_device;
-        VkQueue m_queue;
+        std::array<QueueData, GraphicsDevice::s_queue_type_count> m_queues;
+        std::vector<uint32_t> m_queue_family_indices;
         VmaAllocator m_allocator;
+        MemoryBudgetTracker m_memory_budget;
+
+        ObjectCache<ComputePipeline, ComputePipelineKey> m_compute_pipelines;
+        ObjectCache<GraphicsPipeline, GraphicsPipelineKey> m_graphics_pipelines;
 
         // NOTE: Using raw pointer to guarantee order of destruction
         VulkanDescriptorManager *m_descriptor_manager;
+        VulkanStagingRing *m_staging_ring;
+        VulkanDeletionQueue *m_deletion_queue;
+        VulkanPipelineCache *m_pipeline_cache;
+        VulkanGpuProfiler *m_gpu_profiler;
+
+        hyper_core::ThreadPool *m_thread_pool;
+
+        std::array<FrameData, GraphicsDevice::s_max_frame_count> m_frames;
+
+        std::mutex m_command_pool_mutex;
+        std::unordered_map<std::thread::id, std::unique_ptr<ThreadCommandPools>> m_thread_command_pools;
+
+        uint32_t m_frame_count;
 
-        VkSemaphore m_submit_semaphore;
-        std::array<FrameData, GraphicsDevice::s_frame_count> m_frames;
+        // NOTE: Advanced by the frame thread while recording threads read it to pick their command pools
+        std::atomic<uint32_t> m_current_frame_index;
 
-        uint32_t m_current_frame_index;
+        // NOTE: The upload command buffer and the frame completion values may only be used by one execute per frame
+        mutable uint32_t m_executed_frame_index;
     };
 } // namespace hyper_rhi
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "hyper_rhi/graphics_pipeline.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+    class VulkanPipelineLayout;
+
+    class VulkanGraphicsPipeline final : public GraphicsPipeline
+    {
+    public:
+        VulkanGraphicsPipeline(VulkanGraphicsDevice &graphics_device, const GraphicsPipelineDescriptor &descriptor);
+        ~VulkanGraphicsPipeline() override;
+
+        [[nodiscard]] VkPipelineLayout pipeline_layout() const;
+        [[nodiscard]] VkPipeline pipeline() const;
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        std::shared_ptr<VulkanPipelineLayout> m_layout;
+        VkPipeline m_pipeline;
+    };
+} // namespace hyper_rhi
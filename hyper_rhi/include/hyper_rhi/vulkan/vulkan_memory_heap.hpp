@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/memory_heap.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+#include <vk_mem_alloc.h>
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanMemoryHeap final : public MemoryHeap
+    {
+    public:
+        VulkanMemoryHeap(VulkanGraphicsDevice &graphics_device, const MemoryHeapDescriptor &descriptor);
+        ~VulkanMemoryHeap() override;
+
+        [[nodiscard]] VmaAllocation allocation() const;
+
+    protected:
+        [[nodiscard]] uint64_t byte_size() const override;
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        uint64_t m_byte_size;
+        VmaAllocation m_allocation;
+    };
+} // namespace hyper_rhi
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanPipelineCache
+    {
+    private:
+        static constexpr uint32_t s_magic = 0x43504548;
+        static constexpr uint32_t s_version = 1;
+
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t vendor_id;
+            uint32_t device_id;
+            uint32_t driver_version;
+            uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+            uint32_t padding;
+            uint64_t data_size;
+            uint64_t data_hash;
+        };
+
+        static_assert(sizeof(Header) == 56);
+
+    public:
+        VulkanPipelineCache(VulkanGraphicsDevice &graphics_device, std::string file_path);
+        ~VulkanPipelineCache();
+
+        [[nodiscard]] VkPipelineCache pipeline_cache() const;
+
+        void save() const;
+
+    private:
+        [[nodiscard]] Header create_header() const;
+        [[nodiscard]] std::vector<uint8_t> load() const;
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+        std::string m_file_path;
+
+        VkPipelineCache m_pipeline_cache;
+    };
+} // namespace hyper_rhi
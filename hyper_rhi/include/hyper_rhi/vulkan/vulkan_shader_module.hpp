@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <string>
+
+#include "hyper_rhi/shader_module.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanShaderModule final : public ShaderModule
+    {
+    public:
+        VulkanShaderModule(VulkanGraphicsDevice &graphics_device, const ShaderModuleDescriptor &descriptor);
+        ~VulkanShaderModule() override;
+
+        [[nodiscard]] ShaderType type() const;
+        [[nodiscard]] const std::string &entry_name() const;
+        [[nodiscard]] VkShaderModule shader_module() const;
+
+        [[nodiscard]] VkPipelineShaderStageCreateInfo shader_stage_create_info() const;
+
+    protected:
+        [[nodiscard]] uint64_t hash() const override;
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        ShaderType m_type;
+        std::string m_entry_name;
+        uint64_t m_hash;
+
+        VkShaderModule m_shader_module;
+    };
+} // namespace hyper_rhi
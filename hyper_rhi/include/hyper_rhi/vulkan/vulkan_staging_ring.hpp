@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+#include <vk_mem_alloc.h>
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanStagingRing
+    {
+    private:
+        static constexpr uint64_t s_alignment = 16;
+
+        struct Segment
+        {
+            uint64_t timeline_value;
+            uint64_t end;
+        };
+
+    public:
+        VulkanStagingRing(VulkanGraphicsDevice &graphics_device, uint64_t capacity);
+        ~VulkanStagingRing();
+
+        void write(VkBuffer destination, uint64_t destination_offset, const void *data, uint64_t byte_size);
+
+        void recycle(uint64_t completed_timeline_value);
+        [[nodiscard]] bool record(VkCommandBuffer command_buffer, uint64_t timeline_value);
+
+    private:
+        uint64_t allocate(uint64_t byte_size);
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        VkBuffer m_buffer;
+        VmaAllocation m_allocation;
+        uint8_t *m_mapped_data;
+
+        uint64_t m_capacity;
+        uint64_t m_head;
+        uint64_t m_tail;
+        std::deque<Segment> m_segments;
+
+        // NOTE: Keyed by destination offset, the ranges never overlap because a later write trims the earlier ones
+        std::unordered_map<VkBuffer, std::map<uint64_t, VkBufferCopy>> m_pending_copies;
+
+        std::mutex m_mutex;
+    };
+} // namespace hyper_rhi
@@ -25,11 +25,16 @@ namespace hyper_rhi
         void set_current_texture_index(uint32_t current_texture_index);
         [[nodiscard]] uint32_t current_texture_index() const;
 
-        [[nodiscard]] bool resized() const;
+        void request_rebuild();
+        [[nodiscard]] bool rebuild_requested() const;
 
     protected:
         void resize(uint32_t width, uint32_t height) override;
 
+        void set_present_mode(PresentMode present_mode) override;
+        [[nodiscard]] PresentMode present_mode() const override;
+
+        [[nodiscard]] TextureFormat format() const override;
         [[nodiscard]] TextureHandle current_texture() const override;
 
     private:
@@ -38,7 +43,7 @@ namespace hyper_rhi
         void create_swapchain();
         static VkExtent2D choose_extent(uint32_t width, uint32_t height, const VkSurfaceCapabilitiesKHR &capabilities);
         static VkSurfaceFormatKHR choose_format(const std::vector<VkSurfaceFormatKHR> &formats);
-        static VkPresentModeKHR choose_present_mode(const std::vector<VkPresentModeKHR> &present_modes);
+        static VkPresentModeKHR choose_present_mode(const std::vector<VkPresentModeKHR> &present_modes, PresentMode requested_present_mode);
 
         void destroy();
 
@@ -47,11 +52,14 @@ namespace hyper_rhi
 
         VkSurfaceKHR m_surface;
         VkSwapchainKHR m_swapchain;
+        std::vector<TextureHandle> m_textures;
 
         uint32_t m_current_texture_index;
 
-        bool m_resized;
+        bool m_rebuild_requested;
         uint32_t m_width;
         uint32_t m_height;
+        PresentMode m_present_mode;
+        TextureFormat m_format;
     };
 } // namespace hyper_rhi
\ No newline at end of file
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <string>
+
+#include "hyper_rhi/texture.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+#include <vk_mem_alloc.h>
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanTexture final : public Texture
+    {
+    public:
+        VulkanTexture(VulkanGraphicsDevice &graphics_device, const TextureDescriptor &descriptor);
+
+        // NOTE: Wraps an image owned by someone else, e.g. the swapchain
+        VulkanTexture(VulkanGraphicsDevice &graphics_device, const TextureDescriptor &descriptor, VkImage image);
+        ~VulkanTexture() override;
+
+        [[nodiscard]] static MemoryRequirements memory_requirements(const VulkanGraphicsDevice &graphics_device, const TextureDescriptor &descriptor);
+
+        [[nodiscard]] static VkImageView create_image_view(
+            const VulkanGraphicsDevice &graphics_device,
+            VkImage image,
+            TextureFormat format,
+            TextureDimension dimension,
+            const VkImageSubresourceRange &subresource_range);
+        [[nodiscard]] static VkImageAspectFlags aspect_mask(TextureFormat format);
+
+        [[nodiscard]] VkImage image() const;
+        [[nodiscard]] VkImageView image_view() const;
+        [[nodiscard]] VmaAllocation allocation() const;
+        [[nodiscard]] VkImageAspectFlags aspect_mask() const;
+
+        [[nodiscard]] TextureDimension dimension() const;
+        [[nodiscard]] uint32_t mip_levels() const;
+        [[nodiscard]] uint32_t array_layers() const;
+        [[nodiscard]] bool is_sampled() const;
+        [[nodiscard]] bool is_storage() const;
+
+    protected:
+        [[nodiscard]] TextureFormat format() const override;
+        [[nodiscard]] uint32_t width() const override;
+        [[nodiscard]] uint32_t height() const override;
+
+        [[nodiscard]] ResourceHandle handle() const override;
+        [[nodiscard]] ResourceHandle storage_handle() const override;
+
+    private:
+        static VkImageCreateInfo image_create_info(const VulkanGraphicsDevice &graphics_device, const TextureDescriptor &descriptor);
+
+        void create_views(const std::string &label);
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        TextureFormat m_format;
+        uint32_t m_width;
+        uint32_t m_height;
+        TextureDimension m_dimension;
+        uint32_t m_mip_levels;
+        uint32_t m_array_layers;
+        bool m_is_sampled;
+        bool m_is_storage;
+
+        VkImage m_image;
+        VmaAllocation m_allocation;
+        MemoryHeapHandle m_memory_heap;
+        bool m_owned;
+
+        // NOTE: Sampling reads a single aspect and storage writes a single mip, so both may need views of their own
+        VkImageView m_image_view;
+        VkImageView m_sampled_image_view;
+        VkImageView m_storage_image_view;
+
+        ResourceHandle m_handle;
+        ResourceHandle m_storage_handle;
+    };
+} // namespace hyper_rhi
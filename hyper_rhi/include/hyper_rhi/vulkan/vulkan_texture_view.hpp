@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/texture_view.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+namespace hyper_rhi
+{
+    class VulkanGraphicsDevice;
+
+    class VulkanTextureView final : public TextureView
+    {
+    public:
+        VulkanTextureView(VulkanGraphicsDevice &graphics_device, const TextureViewDescriptor &descriptor);
+        ~VulkanTextureView() override;
+
+        [[nodiscard]] VkImageView image_view() const;
+
+    protected:
+        [[nodiscard]] ResourceHandle handle() const override;
+        [[nodiscard]] ResourceHandle storage_handle() const override;
+
+    private:
+        VulkanGraphicsDevice &m_graphics_device;
+
+        // NOTE: Keeps the texture alive for as long as the view is bound
+        TextureHandle m_texture;
+        bool m_is_sampled;
+        bool m_is_storage;
+
+        VkImageView m_image_view;
+
+        ResourceHandle m_handle;
+        ResourceHandle m_storage_handle;
+    };
+} // namespace hyper_rhi
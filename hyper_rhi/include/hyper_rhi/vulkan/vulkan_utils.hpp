@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include "hyper_rhi/command_list.hpp"
+#include "hyper_rhi/shader_module.hpp"
+#include "hyper_rhi/texture.hpp"
+#include "hyper_rhi/vulkan/vulkan_common.hpp"
+
+namespace hyper_rhi
+{
+    struct VulkanResourceState
+    {
+        VkPipelineStageFlags2 stage_mask;
+        VkAccessFlags2 access_mask;
+        VkImageLayout image_layout;
+    };
+
+    [[nodiscard]] VkFormat format_to_vulkan(TextureFormat format);
+    [[nodiscard]] TextureFormat format_from_vulkan(VkFormat format);
+
+    [[nodiscard]] VkShaderStageFlagBits shader_type_to_vulkan(ShaderType type);
+
+    [[nodiscard]] VulkanResourceState resource_state_to_vulkan(ResourceState state);
+} // namespace hyper_rhi
@@ -44,6 +44,23 @@ namespace hyper_rhi
         return m_command_queue;
     }
 
+    GraphicsApi D3D12GraphicsDevice::graphics_api() const
+    {
+        return GraphicsApi::D3D12;
+    }
+
+    bool D3D12GraphicsDevice::buffer_device_address_supported() const
+    {
+        // NOTE: HLSL has no raw pointer loads on D3D12
+        return false;
+    }
+
+    bool D3D12GraphicsDevice::draw_indirect_count_supported() const
+    {
+        // NOTE: ExecuteIndirect always accepts a count buffer
+        return true;
+    }
+
     SurfaceHandle D3D12GraphicsDevice::create_surface(const SurfaceDescriptor &descriptor)
     {
         return std::make_shared<D3D12Surface>(*this, descriptor);
@@ -56,8 +73,10 @@ namespace hyper_rhi
         HE_UNREACHABLE();
     }
 
-    CommandListHandle D3D12GraphicsDevice::create_command_list()
+    CommandListHandle D3D12GraphicsDevice::create_command_list(const CommandListDescriptor &descriptor)
     {
+        HE_UNUSED(descriptor);
+
         HE_UNREACHABLE();
     }
 
@@ -75,6 +94,13 @@ namespace hyper_rhi
         HE_UNREACHABLE();
     }
 
+    MemoryHeapHandle D3D12GraphicsDevice::create_memory_heap(const MemoryHeapDescriptor &descriptor)
+    {
+        HE_UNUSED(descriptor);
+
+        HE_UNREACHABLE();
+    }
+
     PipelineLayoutHandle D3D12GraphicsDevice::create_pipeline_layout(const PipelineLayoutDescriptor &descriptor)
     {
         HE_UNUSED(descriptor);
@@ -96,6 +122,92 @@ namespace hyper_rhi
         HE_UNREACHABLE();
     }
 
+    TextureViewHandle D3D12GraphicsDevice::create_texture_view(const TextureViewDescriptor &descriptor)
+    {
+        HE_UNUSED(descriptor);
+
+        HE_UNREACHABLE();
+    }
+
+    std::shared_future<ComputePipelineHandle> D3D12GraphicsDevice::create_compute_pipeline_async(const ComputePipelineDescriptor &descriptor)
+    {
+        HE_UNUSED(descriptor);
+
+        HE_UNREACHABLE();
+    }
+
+    std::shared_future<GraphicsPipelineHandle> D3D12GraphicsDevice::create_graphics_pipeline_async(const GraphicsPipelineDescriptor &descriptor)
+    {
+        HE_UNUSED(descriptor);
+
+        HE_UNREACHABLE();
+    }
+
+    void D3D12GraphicsDevice::prewarm_pipelines(
+        const std::span<const ComputePipelineDescriptor> compute_pipeline_descriptors,
+        const std::span<const GraphicsPipelineDescriptor> graphics_pipeline_descriptors)
+    {
+        HE_UNUSED(compute_pipeline_descriptors);
+        HE_UNUSED(graphics_pipeline_descriptors);
+
+        HE_UNREACHABLE();
+    }
+
+    MemoryRequirements D3D12GraphicsDevice::buffer_memory_requirements(const BufferDescriptor &descriptor) const
+    {
+        HE_UNUSED(descriptor);
+
+        HE_UNREACHABLE();
+    }
+
+    MemoryRequirements D3D12GraphicsDevice::texture_memory_requirements(const TextureDescriptor &descriptor) const
+    {
+        HE_UNUSED(descriptor);
+
+        HE_UNREACHABLE();
+    }
+
+    MemoryStatistics D3D12GraphicsDevice::memory_statistics() const
+    {
+        HE_UNREACHABLE();
+    }
+
+    void D3D12GraphicsDevice::add_memory_budget_callback(const MemoryBudgetCallbackDescriptor &descriptor)
+    {
+        HE_UNUSED(descriptor);
+
+        HE_UNREACHABLE();
+    }
+
+    void D3D12GraphicsDevice::write_buffer(const BufferHandle &buffer_handle, const uint64_t offset, const void *data, const uint64_t byte_size)
+    {
+        HE_UNUSED(buffer_handle);
+        HE_UNUSED(offset);
+        HE_UNUSED(data);
+        HE_UNUSED(byte_size);
+
+        HE_UNREACHABLE();
+    }
+
+    void D3D12GraphicsDevice::set_frame_count(const uint32_t frame_count)
+    {
+        HE_UNUSED(frame_count);
+
+        HE_UNREACHABLE();
+    }
+
+    uint32_t D3D12GraphicsDevice::frame_count() const
+    {
+        HE_UNREACHABLE();
+    }
+
+    void D3D12GraphicsDevice::wait_for_frame(const uint32_t frame_index) const
+    {
+        HE_UNUSED(frame_index);
+
+        HE_UNREACHABLE();
+    }
+
     void D3D12GraphicsDevice::begin_frame(SurfaceHandle surface_handle, uint32_t frame_index)
     {
         HE_UNUSED(surface_handle);
@@ -109,8 +221,10 @@ namespace hyper_rhi
         HE_UNREACHABLE();
     }
 
-    void D3D12GraphicsDevice::execute() const
+    void D3D12GraphicsDevice::execute(const std::span<const SubmitDescriptor> submit_descriptors) const
     {
+        HE_UNUSED(submit_descriptors);
+
         HE_UNREACHABLE();
     }
 
@@ -31,6 +31,23 @@ namespace hyper_rhi
         HE_UNREACHABLE();
     }
 
+    void D3D12Surface::set_present_mode(const PresentMode present_mode)
+    {
+        HE_UNUSED(present_mode);
+
+        HE_UNREACHABLE();
+    }
+
+    PresentMode D3D12Surface::present_mode() const
+    {
+        HE_UNREACHABLE();
+    }
+
+    TextureFormat D3D12Surface::format() const
+    {
+        HE_UNREACHABLE();
+    }
+
     TextureHandle D3D12Surface::current_texture() const
     {
         HE_UNREACHABLE();
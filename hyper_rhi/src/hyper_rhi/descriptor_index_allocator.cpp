@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/descriptor_index_allocator.hpp"
+
+#include <hyper_core/assertion.hpp>
+
+namespace hyper_rhi
+{
+    DescriptorIndexAllocator::DescriptorIndexAllocator(const uint32_t capacity)
+        : m_capacity(capacity)
+        , m_free_head(DescriptorIndexAllocator::pack(s_invalid_index, 0))
+        , m_current_index(0)
+        , m_next_indices(std::make_unique<std::atomic<uint32_t>[]>(capacity))
+    {
+        HE_ASSERT(m_capacity < s_invalid_index);
+    }
+
+    uint32_t DescriptorIndexAllocator::allocate()
+    {
+        uint64_t head = m_free_head.load(std::memory_order_acquire);
+        while (DescriptorIndexAllocator::unpack_index(head) != s_invalid_index)
+        {
+            const uint32_t index = DescriptorIndexAllocator::unpack_index(head);
+            const uint32_t next_index = m_next_indices[index].load(std::memory_order_relaxed);
+            const uint64_t new_head = DescriptorIndexAllocator::pack(next_index, DescriptorIndexAllocator::unpack_tag(head) + 1);
+
+            if (m_free_head.compare_exchange_weak(head, new_head, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                return index;
+            }
+        }
+
+        const uint32_t index = m_current_index.fetch_add(1, std::memory_order_relaxed);
+        HE_ASSERT(index < m_capacity, "Descriptor heap with {} descriptors is exhausted", m_capacity);
+
+        return index;
+    }
+
+    void DescriptorIndexAllocator::free(const uint32_t index)
+    {
+        HE_ASSERT(index < m_capacity);
+
+        uint64_t head = m_free_head.load(std::memory_order_relaxed);
+        while (true)
+        {
+            m_next_indices[index].store(DescriptorIndexAllocator::unpack_index(head), std::memory_order_relaxed);
+
+            const uint64_t new_head = DescriptorIndexAllocator::pack(index, DescriptorIndexAllocator::unpack_tag(head) + 1);
+            if (m_free_head.compare_exchange_weak(head, new_head, std::memory_order_release, std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+    uint32_t DescriptorIndexAllocator::capacity() const
+    {
+        return m_capacity;
+    }
+
+    uint64_t DescriptorIndexAllocator::pack(const uint32_t index, const uint32_t tag)
+    {
+        return (static_cast<uint64_t>(tag) << 32) | index;
+    }
+
+    uint32_t DescriptorIndexAllocator::unpack_index(const uint64_t head)
+    {
+        return static_cast<uint32_t>(head & 0xFFFFFFFF);
+    }
+
+    uint32_t DescriptorIndexAllocator::unpack_tag(const uint64_t head)
+    {
+        return static_cast<uint32_t>(head >> 32);
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/frame_allocator.hpp"
+
+#include <limits>
+
+#include <fmt/format.h>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/logger.hpp>
+
+namespace hyper_rhi
+{
+    FrameAllocator::FrameAllocator(GraphicsDevice &graphics_device, const FrameAllocatorDescriptor &descriptor)
+        : m_byte_size(descriptor.byte_size)
+        , m_buffers()
+        , m_current_slot(0)
+        , m_head(0)
+    {
+        HE_ASSERT(m_byte_size > 0);
+        HE_ASSERT(m_byte_size <= std::numeric_limits<uint32_t>::max(), "Offsets into a frame slot have to fit into 32 bits");
+
+        for (size_t slot = 0; slot < m_buffers.size(); ++slot)
+        {
+            m_buffers[slot] = graphics_device.create_buffer({
+                .label = fmt::format("{} #{}", descriptor.label, slot),
+                .byte_size = m_byte_size,
+                .is_index_buffer = false,
+                .is_constant_buffer = true,
+                .is_device_addressable = descriptor.is_device_addressable,
+                .memory_location = MemoryLocation::GpuUpload,
+            });
+            HE_ASSERT(m_buffers[slot]->mapped_data() != nullptr);
+        }
+
+        HE_TRACE("Created Frame Allocator '{}' with {} bytes per frame", descriptor.label, m_byte_size);
+    }
+
+    void FrameAllocator::begin_frame(const uint32_t frame_index)
+    {
+        m_current_slot = frame_index % static_cast<uint32_t>(m_buffers.size());
+        m_head.store(0, std::memory_order_relaxed);
+    }
+
+    std::optional<FrameAllocation> FrameAllocator::allocate(const uint64_t byte_size, const uint64_t alignment)
+    {
+        HE_ASSERT((alignment & (alignment - 1)) == 0, "Alignment {} is not a power of two", alignment);
+
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        uint64_t offset = 0;
+        do
+        {
+            offset = (head + alignment - 1) & ~(alignment - 1);
+            if (offset > m_byte_size || byte_size > m_byte_size - offset)
+            {
+                HE_ERROR("Frame allocation of {} bytes exceeds the frame allocator capacity of {} bytes", byte_size, m_byte_size);
+                return std::nullopt;
+            }
+        } while (!m_head.compare_exchange_weak(head, offset + byte_size, std::memory_order_relaxed));
+
+        const BufferHandle &buffer = m_buffers[m_current_slot];
+        const uint64_t device_address = buffer->device_address();
+
+        return FrameAllocation{
+            .buffer =
+                TransientBuffer{
+                    .handle = buffer->handle(),
+                    .offset = static_cast<uint32_t>(offset),
+                },
+            .device_address = device_address != 0 ? device_address + offset : 0,
+            .mapped_data = buffer->mapped_data() + offset,
+        };
+    }
+
+    uint64_t FrameAllocator::byte_size() const
+    {
+        return m_byte_size;
+    }
+
+    uint64_t FrameAllocator::used_byte_size() const
+    {
+        return m_head.load(std::memory_order_relaxed);
+    }
+} // namespace hyper_rhi
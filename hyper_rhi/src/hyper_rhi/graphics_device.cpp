@@ -12,6 +12,7 @@
 #    include "hyper_rhi/d3d12/d3d12_graphics_device.hpp"
 #endif
 
+#include "hyper_rhi/null/null_graphics_device.hpp"
 #include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
 
 namespace hyper_rhi
@@ -28,6 +29,8 @@ namespace hyper_rhi
 #endif
         case GraphicsApi::Vulkan:
             return std::make_shared<VulkanGraphicsDevice>(descriptor);
+        case GraphicsApi::Null:
+            return std::make_shared<NullGraphicsDevice>(descriptor);
         default:
             HE_UNREACHABLE();
         }
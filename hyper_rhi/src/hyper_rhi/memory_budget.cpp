@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/memory_budget.hpp"
+
+#include <algorithm>
+#include <string_view>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/logger.hpp>
+
+namespace hyper_rhi
+{
+    static constexpr std::array<std::string_view, g_memory_category_count> g_memory_category_names = {
+        "Buffers",
+        "Textures",
+        "Transient",
+    };
+
+    MemoryBudgetTracker::MemoryBudgetTracker()
+        : m_allocation_counts()
+        , m_byte_sizes()
+        , m_mutex()
+        , m_heaps()
+        , m_callbacks()
+    {
+    }
+
+    void MemoryBudgetTracker::track_allocation(const MemoryCategory category, const uint64_t byte_size)
+    {
+        m_allocation_counts[static_cast<size_t>(category)].fetch_add(1, std::memory_order_relaxed);
+        m_byte_sizes[static_cast<size_t>(category)].fetch_add(byte_size, std::memory_order_relaxed);
+    }
+
+    void MemoryBudgetTracker::untrack_allocation(const MemoryCategory category, const uint64_t byte_size)
+    {
+        m_allocation_counts[static_cast<size_t>(category)].fetch_sub(1, std::memory_order_relaxed);
+        m_byte_sizes[static_cast<size_t>(category)].fetch_sub(byte_size, std::memory_order_relaxed);
+    }
+
+    void MemoryBudgetTracker::add_callback(const MemoryBudgetCallbackDescriptor &descriptor)
+    {
+        HE_ASSERT(descriptor.threshold > 0.0f);
+        HE_ASSERT(descriptor.callback);
+
+        const std::lock_guard lock(m_mutex);
+        m_callbacks.push_back({
+            .threshold = descriptor.threshold,
+            .callback = descriptor.callback,
+            .exceeded = std::vector<bool>(m_heaps.size(), false),
+        });
+    }
+
+    void MemoryBudgetTracker::update(std::vector<MemoryHeapBudget> heaps)
+    {
+        std::vector<std::pair<MemoryBudgetCallback, MemoryBudgetEvent>> events;
+
+        {
+            const std::lock_guard lock(m_mutex);
+
+            for (MemoryHeapBudget &heap : heaps)
+            {
+                const uint64_t previous_peak_usage = heap.heap_index < m_heaps.size() ? m_heaps[heap.heap_index].peak_usage : 0;
+                heap.peak_usage = std::max(previous_peak_usage, heap.usage);
+            }
+
+            m_heaps = std::move(heaps);
+
+            for (Callback &callback : m_callbacks)
+            {
+                callback.exceeded.resize(m_heaps.size(), false);
+
+                for (const MemoryHeapBudget &heap : m_heaps)
+                {
+                    if (!heap.device_local || heap.budget == 0)
+                    {
+                        continue;
+                    }
+
+                    const float usage_ratio = static_cast<float>(heap.usage) / static_cast<float>(heap.budget);
+                    const bool exceeded = usage_ratio >= callback.threshold;
+                    if (exceeded == callback.exceeded[heap.heap_index])
+                    {
+                        continue;
+                    }
+
+                    callback.exceeded[heap.heap_index] = exceeded;
+                    events.emplace_back(
+                        callback.callback,
+                        MemoryBudgetEvent{
+                            .heap = heap,
+                            .threshold = callback.threshold,
+                            .exceeded = exceeded,
+                        });
+                }
+            }
+        }
+
+        // NOTE: Callbacks run without the lock, so they are free to query the statistics again
+        for (const auto &[callback, event] : events)
+        {
+            callback(event);
+        }
+    }
+
+    MemoryStatistics MemoryBudgetTracker::statistics() const
+    {
+        MemoryStatistics statistics = {};
+
+        {
+            const std::lock_guard lock(m_mutex);
+            statistics.heaps = m_heaps;
+        }
+
+        for (size_t category = 0; category < g_memory_category_count; ++category)
+        {
+            statistics.categories[category] = {
+                .allocation_count = m_allocation_counts[category].load(std::memory_order_relaxed),
+                .byte_size = m_byte_sizes[category].load(std::memory_order_relaxed),
+            };
+        }
+
+        return statistics;
+    }
+
+    void MemoryBudgetTracker::log_statistics() const
+    {
+        const MemoryStatistics statistics = this->statistics();
+
+        for (const MemoryHeapBudget &heap : statistics.heaps)
+        {
+            HE_INFO(
+                "Memory heap #{}{}: {} of {} bytes used ({} peak), {} bytes in {} allocations",
+                heap.heap_index,
+                heap.device_local ? " (device local)" : "",
+                heap.usage,
+                heap.budget,
+                heap.peak_usage,
+                heap.allocation_byte_size,
+                heap.allocation_count);
+        }
+
+        for (size_t category = 0; category < g_memory_category_count; ++category)
+        {
+            HE_INFO(
+                "Memory {}: {} bytes in {} allocations",
+                g_memory_category_names[category],
+                statistics.categories[category].byte_size,
+                statistics.categories[category].allocation_count);
+        }
+    }
+} // namespace hyper_rhi
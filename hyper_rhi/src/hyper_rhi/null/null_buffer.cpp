@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_buffer.hpp"
+
+#include <fmt/format.h>
+
+#include <hyper_core/assertion.hpp>
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    static constexpr uint64_t s_buffer_alignment = 256;
+
+    NullBuffer::NullBuffer(NullGraphicsDevice &graphics_device, const BufferDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_byte_size(descriptor.byte_size)
+        , m_memory_location(descriptor.memory_location)
+        , m_mapped_data(nullptr)
+        , m_memory_heap(descriptor.memory_heap)
+        , m_allocation_byte_size(m_memory_heap ? 0 : NullBuffer::memory_requirements(descriptor).byte_size)
+        , m_device_address(0)
+        , m_handle(DescriptorIndexAllocator::s_invalid_index)
+    {
+        HE_ASSERT(m_byte_size > 0);
+
+        // NOTE: The address is never dereferenced, it only has to be unique and non-zero
+        if (descriptor.is_device_addressable)
+        {
+            m_device_address = reinterpret_cast<uint64_t>(this);
+        }
+        else
+        {
+            m_handle = ResourceHandle(m_graphics_device.descriptor_index_allocator().allocate());
+            HE_ASSERT(m_handle.handle() != DescriptorIndexAllocator::s_invalid_index);
+        }
+
+        if (m_graphics_device.validation_enabled() && m_memory_heap &&
+            descriptor.memory_heap_offset + NullBuffer::memory_requirements(descriptor).byte_size > m_memory_heap->byte_size())
+        {
+            m_graphics_device.report_validation_error(fmt::format(
+                "Buffer '{}' placed at offset {} exceeds its memory heap of {} bytes",
+                descriptor.label,
+                descriptor.memory_heap_offset,
+                m_memory_heap->byte_size()));
+        }
+
+        if (m_memory_location != MemoryLocation::GpuOnly)
+        {
+            m_mapped_data = std::make_unique<uint8_t[]>(m_byte_size);
+        }
+
+        if (!m_memory_heap)
+        {
+            m_graphics_device.memory_budget().track_allocation(MemoryCategory::Buffer, m_allocation_byte_size);
+        }
+
+        m_graphics_device.track_resource(NullResourceType::Buffer);
+    }
+
+    NullBuffer::~NullBuffer()
+    {
+        if (m_handle.handle() != DescriptorIndexAllocator::s_invalid_index)
+        {
+            m_graphics_device.descriptor_index_allocator().free(m_handle.handle());
+        }
+
+        if (!m_memory_heap)
+        {
+            m_graphics_device.memory_budget().untrack_allocation(MemoryCategory::Buffer, m_allocation_byte_size);
+        }
+
+        m_graphics_device.untrack_resource(NullResourceType::Buffer);
+    }
+
+    MemoryRequirements NullBuffer::memory_requirements(const BufferDescriptor &descriptor)
+    {
+        return {
+            .byte_size = (descriptor.byte_size + s_buffer_alignment - 1) & ~(s_buffer_alignment - 1),
+            .alignment = s_buffer_alignment,
+            .memory_types = ~0u,
+        };
+    }
+
+    uint64_t NullBuffer::byte_size() const
+    {
+        return m_byte_size;
+    }
+
+    MemoryLocation NullBuffer::memory_location() const
+    {
+        return m_memory_location;
+    }
+
+    uint8_t *NullBuffer::mapped_data() const
+    {
+        return m_mapped_data.get();
+    }
+
+    uint64_t NullBuffer::device_address() const
+    {
+        return m_device_address;
+    }
+
+    ResourceHandle NullBuffer::handle() const
+    {
+        return m_handle;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_command_list.hpp"
+
+#include <fmt/format.h>
+
+#include <hyper_core/prerequisites.hpp>
+
+namespace hyper_rhi
+{
+    NullCommandList::NullCommandList(NullGraphicsDevice &graphics_device, const CommandListDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_queue_type(descriptor.queue_type)
+        , m_recording(false)
+        , m_recorded(false)
+        , m_gpu_scope_depth(0)
+        , m_render_pass_active(false)
+        , m_pipeline_bound(false)
+        , m_index_buffer_bound(false)
+        , m_statistics()
+    {
+        m_graphics_device.track_resource(NullResourceType::CommandList);
+    }
+
+    NullCommandList::~NullCommandList()
+    {
+        m_graphics_device.untrack_resource(NullResourceType::CommandList);
+    }
+
+    bool NullCommandList::recording() const
+    {
+        return m_recording;
+    }
+
+    bool NullCommandList::recorded() const
+    {
+        return m_recorded;
+    }
+
+    const NullStatistics &NullCommandList::statistics() const
+    {
+        return m_statistics;
+    }
+
+    QueueType NullCommandList::queue_type() const
+    {
+        return m_queue_type;
+    }
+
+    void NullCommandList::begin()
+    {
+        if (m_graphics_device.validation_enabled() && m_recording)
+        {
+            m_graphics_device.report_validation_error("Command list began while it was still recording");
+        }
+
+        m_recording = true;
+        m_recorded = false;
+        m_gpu_scope_depth = 0;
+        m_render_pass_active = false;
+        m_pipeline_bound = false;
+        m_index_buffer_bound = false;
+        m_statistics = {};
+    }
+
+    void NullCommandList::end()
+    {
+        this->validate_recording("end");
+
+        if (m_graphics_device.validation_enabled() && m_gpu_scope_depth != 0)
+        {
+            m_graphics_device.report_validation_error(fmt::format("Command list ended with {} open GPU scopes", m_gpu_scope_depth));
+        }
+
+        if (m_graphics_device.validation_enabled() && m_render_pass_active)
+        {
+            m_graphics_device.report_validation_error("Command list ended inside of a render pass");
+        }
+
+        m_recording = false;
+        m_recorded = true;
+    }
+
+    void NullCommandList::barrier(const std::span<const BufferBarrier> buffer_barriers, const std::span<const TextureBarrier> texture_barriers)
+    {
+        this->validate_recording("barrier");
+
+        if (buffer_barriers.empty() && texture_barriers.empty())
+        {
+            return;
+        }
+
+        if (m_graphics_device.validation_enabled())
+        {
+            for (const BufferBarrier &buffer_barrier : buffer_barriers)
+            {
+                if (!buffer_barrier.buffer)
+                {
+                    m_graphics_device.report_validation_error("Buffer barrier without a buffer");
+                }
+            }
+
+            for (const TextureBarrier &texture_barrier : texture_barriers)
+            {
+                if (!texture_barrier.texture)
+                {
+                    m_graphics_device.report_validation_error("Texture barrier without a texture");
+                }
+            }
+        }
+
+        m_statistics.barrier_batch_count += 1;
+        m_statistics.buffer_barrier_count += buffer_barriers.size();
+        m_statistics.texture_barrier_count += texture_barriers.size();
+    }
+
+    void NullCommandList::begin_gpu_scope(const std::string_view name)
+    {
+        HE_UNUSED(name);
+
+        this->validate_recording("begin_gpu_scope");
+
+        m_gpu_scope_depth += 1;
+        m_statistics.gpu_scope_count += 1;
+    }
+
+    void NullCommandList::end_gpu_scope()
+    {
+        this->validate_recording("end_gpu_scope");
+
+        if (m_gpu_scope_depth == 0)
+        {
+            if (m_graphics_device.validation_enabled())
+            {
+                m_graphics_device.report_validation_error("GPU scope ended without being begun");
+            }
+
+            return;
+        }
+
+        m_gpu_scope_depth -= 1;
+    }
+
+    void NullCommandList::begin_render_pass(const RenderPassDescriptor &descriptor)
+    {
+        this->validate_recording("begin_render_pass");
+
+        if (m_graphics_device.validation_enabled())
+        {
+            if (m_render_pass_active)
+            {
+                m_graphics_device.report_validation_error(fmt::format("Render pass '{}' began inside of another render pass", descriptor.label));
+            }
+
+            if (!descriptor.color_attachment)
+            {
+                m_graphics_device.report_validation_error(fmt::format("Render pass '{}' has no color attachment", descriptor.label));
+            }
+        }
+
+        m_render_pass_active = true;
+        m_statistics.render_pass_count += 1;
+    }
+
+    void NullCommandList::end_render_pass()
+    {
+        this->validate_recording("end_render_pass");
+
+        if (m_graphics_device.validation_enabled() && !m_render_pass_active)
+        {
+            m_graphics_device.report_validation_error("Render pass ended without being begun");
+        }
+
+        m_render_pass_active = false;
+    }
+
+    void NullCommandList::set_pipeline(const GraphicsPipelineHandle &pipeline)
+    {
+        this->validate_recording("set_pipeline");
+
+        if (m_graphics_device.validation_enabled() && !pipeline)
+        {
+            m_graphics_device.report_validation_error("Pipeline set without a pipeline");
+        }
+
+        m_pipeline_bound = true;
+    }
+
+    void NullCommandList::set_index_buffer(const BufferHandle &buffer)
+    {
+        this->validate_recording("set_index_buffer");
+
+        if (m_graphics_device.validation_enabled() && !buffer)
+        {
+            m_graphics_device.report_validation_error("Index buffer set without a buffer");
+        }
+
+        m_index_buffer_bound = true;
+    }
+
+    void NullCommandList::set_push_constants(const void *data, const size_t byte_size)
+    {
+        this->validate_recording("set_push_constants");
+
+        if (m_graphics_device.validation_enabled())
+        {
+            if (data == nullptr)
+            {
+                m_graphics_device.report_validation_error("Push constants set without data");
+            }
+
+            if (byte_size % sizeof(uint32_t) != 0)
+            {
+                m_graphics_device.report_validation_error(fmt::format("Push constant size of {} bytes is not a multiple of 4", byte_size));
+            }
+
+            if (!m_pipeline_bound)
+            {
+                m_graphics_device.report_validation_error("Push constants set before a pipeline");
+            }
+        }
+    }
+
+    void NullCommandList::draw_indexed_indirect(const BufferHandle &argument_buffer, const uint64_t argument_offset, const uint32_t draw_count)
+    {
+        this->validate_recording("draw_indexed_indirect");
+        this->validate_draw("draw_indexed_indirect", argument_buffer, argument_offset, draw_count);
+
+        m_statistics.indirect_draw_count += 1;
+    }
+
+    void NullCommandList::draw_indexed_indirect_count(
+        const BufferHandle &argument_buffer,
+        const uint64_t argument_offset,
+        const BufferHandle &count_buffer,
+        const uint64_t count_offset,
+        const uint32_t max_draw_count)
+    {
+        this->validate_recording("draw_indexed_indirect_count");
+        this->validate_draw("draw_indexed_indirect_count", argument_buffer, argument_offset, max_draw_count);
+
+        if (m_graphics_device.validation_enabled())
+        {
+            if (!count_buffer)
+            {
+                m_graphics_device.report_validation_error("Indirect count draw without a count buffer");
+            }
+            else if (count_offset % sizeof(uint32_t) != 0 || count_offset + sizeof(uint32_t) > count_buffer->byte_size())
+            {
+                m_graphics_device.report_validation_error(
+                    fmt::format("Draw count at offset {} is out of bounds of a {} byte buffer", count_offset, count_buffer->byte_size()));
+            }
+        }
+
+        m_statistics.indirect_draw_count += 1;
+    }
+
+    void NullCommandList::validate_recording(const std::string_view command) const
+    {
+        if (m_graphics_device.validation_enabled() && !m_recording)
+        {
+            m_graphics_device.report_validation_error(fmt::format("Command list recorded '{}' outside of begin and end", command));
+        }
+    }
+
+    void NullCommandList::validate_draw(
+        const std::string_view command,
+        const BufferHandle &argument_buffer,
+        const uint64_t argument_offset,
+        const uint32_t draw_count) const
+    {
+        if (!m_graphics_device.validation_enabled())
+        {
+            return;
+        }
+
+        if (!m_render_pass_active)
+        {
+            m_graphics_device.report_validation_error(fmt::format("'{}' recorded outside of a render pass", command));
+        }
+
+        if (!m_pipeline_bound || !m_index_buffer_bound)
+        {
+            m_graphics_device.report_validation_error(fmt::format("'{}' recorded without a pipeline and an index buffer", command));
+        }
+
+        if (!argument_buffer)
+        {
+            m_graphics_device.report_validation_error(fmt::format("'{}' recorded without an argument buffer", command));
+            return;
+        }
+
+        const uint64_t argument_byte_size = static_cast<uint64_t>(draw_count) * sizeof(DrawIndexedIndirectArguments);
+        if (argument_offset % sizeof(uint32_t) != 0 || argument_offset + argument_byte_size > argument_buffer->byte_size())
+        {
+            m_graphics_device.report_validation_error(fmt::format(
+                "'{}' reads {} draws at offset {} out of bounds of a {} byte buffer",
+                command,
+                draw_count,
+                argument_offset,
+                argument_buffer->byte_size()));
+        }
+    }
+} // namespace hyper_rhi
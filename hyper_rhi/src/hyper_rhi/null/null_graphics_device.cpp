@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#include <fmt/format.h>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/logger.hpp>
+#include <hyper_core/prerequisites.hpp>
+
+#include "hyper_rhi/null/null_buffer.hpp"
+#include "hyper_rhi/null/null_command_list.hpp"
+#include "hyper_rhi/null/null_compute_pipeline.hpp"
+#include "hyper_rhi/null/null_graphics_pipeline.hpp"
+#include "hyper_rhi/null/null_memory_heap.hpp"
+#include "hyper_rhi/null/null_pipeline_layout.hpp"
+#include "hyper_rhi/null/null_shader_module.hpp"
+#include "hyper_rhi/null/null_surface.hpp"
+#include "hyper_rhi/null/null_texture.hpp"
+#include "hyper_rhi/null/null_texture_view.hpp"
+
+namespace hyper_rhi
+{
+    NullGraphicsDevice::NullGraphicsDevice(const GraphicsDeviceDescriptor &descriptor)
+        : m_validation_enabled(descriptor.debug_mode)
+        , m_descriptor_index_allocator(static_cast<uint32_t>(GraphicsDevice::s_descriptor_limit))
+        , m_memory_budget()
+        , m_compute_pipelines()
+        , m_graphics_pipelines()
+        , m_live_resource_counts()
+        , m_statistics_mutex()
+        , m_statistics()
+        , m_frame_count(descriptor.frame_count)
+        , m_current_frame_index(0)
+        , m_frame_active(false)
+        , m_frame_executed(false)
+    {
+        HE_ASSERT(m_frame_count >= GraphicsDevice::s_min_frame_count && m_frame_count <= GraphicsDevice::s_max_frame_count);
+
+        HE_DEBUG("Created Null Graphics Device with validation {}", m_validation_enabled ? "enabled" : "disabled");
+    }
+
+    NullGraphicsDevice::~NullGraphicsDevice()
+    {
+        if (m_validation_enabled)
+        {
+            for (size_t resource_type = 0; resource_type < s_resource_type_count; ++resource_type)
+            {
+                const int64_t live_resource_count = m_live_resource_counts[resource_type];
+                if (live_resource_count != 0)
+                {
+                    this->report_validation_error(fmt::format(
+                        "{} {} resources outlive the device",
+                        live_resource_count,
+                        NullGraphicsDevice::resource_type_name(static_cast<NullResourceType>(resource_type))));
+                }
+            }
+        }
+
+        const NullStatistics statistics = this->statistics();
+        HE_DEBUG(
+            "Destroyed Null Graphics Device after {} frames, {} submits, {} command lists, {} barriers in {} batches, {} render passes, "
+            "{} indirect draws, {} buffer writes with {} bytes and {} validation errors",
+            statistics.frame_count,
+            statistics.submit_count,
+            statistics.command_list_count,
+            statistics.buffer_barrier_count + statistics.texture_barrier_count,
+            statistics.barrier_batch_count,
+            statistics.render_pass_count,
+            statistics.indirect_draw_count,
+            statistics.buffer_write_count,
+            statistics.buffer_write_byte_size,
+            statistics.validation_error_count);
+
+        m_memory_budget.log_statistics();
+        log_statistics("Compute pipeline", m_compute_pipelines.statistics());
+        log_statistics("Graphics pipeline", m_graphics_pipelines.statistics());
+    }
+
+    bool NullGraphicsDevice::validation_enabled() const
+    {
+        return m_validation_enabled;
+    }
+
+    void NullGraphicsDevice::report_validation_error(const std::string_view message) const
+    {
+        {
+            const std::lock_guard lock(m_statistics_mutex);
+            m_statistics.validation_error_count += 1;
+        }
+
+        HE_ERROR("Null validation: {}", message);
+    }
+
+    DescriptorIndexAllocator &NullGraphicsDevice::descriptor_index_allocator()
+    {
+        return m_descriptor_index_allocator;
+    }
+
+    MemoryBudgetTracker &NullGraphicsDevice::memory_budget()
+    {
+        return m_memory_budget;
+    }
+
+    void NullGraphicsDevice::track_resource(const NullResourceType resource_type)
+    {
+        m_live_resource_counts[static_cast<size_t>(resource_type)] += 1;
+    }
+
+    void NullGraphicsDevice::untrack_resource(const NullResourceType resource_type)
+    {
+        const int64_t live_resource_count = --m_live_resource_counts[static_cast<size_t>(resource_type)];
+        if (m_validation_enabled && live_resource_count < 0)
+        {
+            this->report_validation_error(
+                fmt::format("{} was destroyed more often than created", NullGraphicsDevice::resource_type_name(resource_type)));
+        }
+    }
+
+    void NullGraphicsDevice::record_commands(const NullStatistics &command_statistics) const
+    {
+        const std::lock_guard lock(m_statistics_mutex);
+
+        m_statistics.command_list_count += 1;
+        m_statistics.barrier_batch_count += command_statistics.barrier_batch_count;
+        m_statistics.buffer_barrier_count += command_statistics.buffer_barrier_count;
+        m_statistics.texture_barrier_count += command_statistics.texture_barrier_count;
+        m_statistics.gpu_scope_count += command_statistics.gpu_scope_count;
+        m_statistics.render_pass_count += command_statistics.render_pass_count;
+        m_statistics.indirect_draw_count += command_statistics.indirect_draw_count;
+    }
+
+    NullStatistics NullGraphicsDevice::statistics() const
+    {
+        const std::lock_guard lock(m_statistics_mutex);
+
+        return m_statistics;
+    }
+
+    GraphicsApi NullGraphicsDevice::graphics_api() const
+    {
+        return GraphicsApi::Null;
+    }
+
+    bool NullGraphicsDevice::buffer_device_address_supported() const
+    {
+        return true;
+    }
+
+    bool NullGraphicsDevice::draw_indirect_count_supported() const
+    {
+        return true;
+    }
+
+    SurfaceHandle NullGraphicsDevice::create_surface(const SurfaceDescriptor &descriptor)
+    {
+        return std::make_shared<NullSurface>(*this, descriptor);
+    }
+
+    BufferHandle NullGraphicsDevice::create_buffer(const BufferDescriptor &descriptor)
+    {
+        return std::make_shared<NullBuffer>(*this, descriptor);
+    }
+
+    CommandListHandle NullGraphicsDevice::create_command_list(const CommandListDescriptor &descriptor)
+    {
+        return std::make_shared<NullCommandList>(*this, descriptor);
+    }
+
+    ComputePipelineHandle NullGraphicsDevice::create_compute_pipeline(const ComputePipelineDescriptor &descriptor)
+    {
+        return m_compute_pipelines.get_or_create(
+            object_key(descriptor),
+            [this, &descriptor]()
+            {
+                return std::make_shared<NullComputePipeline>(*this, descriptor);
+            });
+    }
+
+    GraphicsPipelineHandle NullGraphicsDevice::create_graphics_pipeline(const GraphicsPipelineDescriptor &descriptor)
+    {
+        return m_graphics_pipelines.get_or_create(
+            object_key(descriptor),
+            [this, &descriptor]()
+            {
+                return std::make_shared<NullGraphicsPipeline>(*this, descriptor);
+            });
+    }
+
+    MemoryHeapHandle NullGraphicsDevice::create_memory_heap(const MemoryHeapDescriptor &descriptor)
+    {
+        return std::make_shared<NullMemoryHeap>(*this, descriptor);
+    }
+
+    PipelineLayoutHandle NullGraphicsDevice::create_pipeline_layout(const PipelineLayoutDescriptor &descriptor)
+    {
+        return std::make_shared<NullPipelineLayout>(*this, descriptor);
+    }
+
+    ShaderModuleHandle NullGraphicsDevice::create_shader_module(const ShaderModuleDescriptor &descriptor)
+    {
+        return std::make_shared<NullShaderModule>(*this, descriptor);
+    }
+
+    TextureHandle NullGraphicsDevice::create_texture(const TextureDescriptor &descriptor)
+    {
+        return std::make_shared<NullTexture>(*this, descriptor);
+    }
+
+    TextureViewHandle NullGraphicsDevice::create_texture_view(const TextureViewDescriptor &descriptor)
+    {
+        return std::make_shared<NullTextureView>(*this, descriptor);
+    }
+
+    std::shared_future<ComputePipelineHandle> NullGraphicsDevice::create_compute_pipeline_async(const ComputePipelineDescriptor &descriptor)
+    {
+        std::promise<ComputePipelineHandle> promise;
+        promise.set_value(this->create_compute_pipeline(descriptor));
+
+        return promise.get_future().share();
+    }
+
+    std::shared_future<GraphicsPipelineHandle> NullGraphicsDevice::create_graphics_pipeline_async(const GraphicsPipelineDescriptor &descriptor)
+    {
+        std::promise<GraphicsPipelineHandle> promise;
+        promise.set_value(this->create_graphics_pipeline(descriptor));
+
+        return promise.get_future().share();
+    }
+
+    void NullGraphicsDevice::prewarm_pipelines(
+        const std::span<const ComputePipelineDescriptor> compute_pipeline_descriptors,
+        const std::span<const GraphicsPipelineDescriptor> graphics_pipeline_descriptors)
+    {
+        HE_UNUSED(compute_pipeline_descriptors);
+        HE_UNUSED(graphics_pipeline_descriptors);
+    }
+
+    MemoryRequirements NullGraphicsDevice::buffer_memory_requirements(const BufferDescriptor &descriptor) const
+    {
+        return NullBuffer::memory_requirements(descriptor);
+    }
+
+    MemoryRequirements NullGraphicsDevice::texture_memory_requirements(const TextureDescriptor &descriptor) const
+    {
+        return NullTexture::memory_requirements(descriptor);
+    }
+
+    MemoryStatistics NullGraphicsDevice::memory_statistics() const
+    {
+        return m_memory_budget.statistics();
+    }
+
+    void NullGraphicsDevice::add_memory_budget_callback(const MemoryBudgetCallbackDescriptor &descriptor)
+    {
+        m_memory_budget.add_callback(descriptor);
+    }
+
+    void NullGraphicsDevice::write_buffer(const BufferHandle &buffer_handle, const uint64_t offset, const void *data, const uint64_t byte_size)
+    {
+        HE_ASSERT(buffer_handle);
+        HE_ASSERT(data != nullptr || byte_size == 0);
+
+        if (m_validation_enabled && offset + byte_size > buffer_handle->byte_size())
+        {
+            this->report_validation_error(fmt::format(
+                "Buffer write of {} bytes at offset {} exceeds the buffer size of {} bytes",
+                byte_size,
+                offset,
+                buffer_handle->byte_size()));
+            return;
+        }
+
+        // NOTE: Host visible buffers keep their contents, so readbacks of written data still work
+        if (uint8_t *mapped_data = buffer_handle->mapped_data(); mapped_data != nullptr && byte_size != 0)
+        {
+            std::memcpy(mapped_data + offset, data, byte_size);
+        }
+
+        const std::lock_guard lock(m_statistics_mutex);
+
+        m_statistics.buffer_write_count += 1;
+        m_statistics.buffer_write_byte_size += byte_size;
+    }
+
+    void NullGraphicsDevice::set_frame_count(const uint32_t frame_count)
+    {
+        HE_ASSERT(frame_count >= GraphicsDevice::s_min_frame_count && frame_count <= GraphicsDevice::s_max_frame_count);
+
+        m_frame_count = frame_count;
+    }
+
+    uint32_t NullGraphicsDevice::frame_count() const
+    {
+        return m_frame_count;
+    }
+
+    void NullGraphicsDevice::wait_for_frame(const uint32_t frame_index) const
+    {
+        HE_UNUSED(frame_index);
+    }
+
+    void NullGraphicsDevice::begin_frame(const SurfaceHandle surface_handle, const uint32_t frame_index)
+    {
+        const std::shared_ptr<NullSurface> surface = std::dynamic_pointer_cast<NullSurface>(surface_handle);
+        HE_ASSERT(surface);
+
+        if (m_validation_enabled)
+        {
+            if (m_frame_active)
+            {
+                this->report_validation_error(fmt::format("Frame {} began before frame {} was presented", frame_index, m_current_frame_index));
+            }
+
+            if (frame_index <= m_current_frame_index)
+            {
+                this->report_validation_error(fmt::format("Frame index {} doesn't follow frame index {}", frame_index, m_current_frame_index));
+            }
+        }
+
+        m_current_frame_index = frame_index;
+        m_frame_active = true;
+        m_frame_executed = false;
+
+        surface->acquire_next_texture();
+
+        // NOTE: Placed resources don't own memory, so the tracked categories are exactly the heap usage
+        MemoryStatistics memory_statistics = m_memory_budget.statistics();
+
+        MemoryHeapBudget heap = {
+            .heap_index = 0,
+            .device_local = true,
+            .usage = 0,
+            .budget = s_memory_budget,
+            .peak_usage = 0,
+            .allocation_byte_size = 0,
+            .allocation_count = 0,
+        };
+
+        for (const MemoryCategoryStatistics &category : memory_statistics.categories)
+        {
+            heap.allocation_byte_size += category.byte_size;
+            heap.allocation_count += category.allocation_count;
+        }
+
+        heap.usage = heap.allocation_byte_size;
+
+        m_memory_budget.update({ heap });
+    }
+
+    void NullGraphicsDevice::end_frame() const
+    {
+        if (m_validation_enabled && !m_frame_active)
+        {
+            this->report_validation_error("Frame ended without being begun");
+        }
+    }
+
+    void NullGraphicsDevice::execute(const std::span<const SubmitDescriptor> submit_descriptors) const
+    {
+        if (m_validation_enabled)
+        {
+            if (!m_frame_active)
+            {
+                this->report_validation_error("Command lists were executed outside of a frame");
+            }
+
+            if (m_frame_executed)
+            {
+                this->report_validation_error(fmt::format("Frame {} was executed more than once", m_current_frame_index));
+            }
+
+            m_frame_executed = true;
+
+            // NOTE: Mirrors the timeline rules, values have to increase per queue and waits have to target a signal of the same call
+            std::map<QueueType, uint64_t> signaled_values;
+            for (const SubmitDescriptor &submit_descriptor : submit_descriptors)
+            {
+                const std::shared_ptr<NullCommandList> command_list = std::dynamic_pointer_cast<NullCommandList>(submit_descriptor.command_list);
+                HE_ASSERT(command_list);
+
+                if (command_list->recording() || !command_list->recorded())
+                {
+                    this->report_validation_error("Submitted command list has to be ended first");
+                }
+
+                if (submit_descriptor.signal_value == 0)
+                {
+                    continue;
+                }
+
+                uint64_t &signaled_value = signaled_values[submit_descriptor.command_list->queue_type()];
+                if (submit_descriptor.signal_value <= signaled_value)
+                {
+                    this->report_validation_error(fmt::format(
+                        "Timeline value {} doesn't increase past the previously signalled value {}",
+                        submit_descriptor.signal_value,
+                        signaled_value));
+                }
+
+                signaled_value = std::max(signaled_value, submit_descriptor.signal_value);
+            }
+
+            for (const SubmitDescriptor &submit_descriptor : submit_descriptors)
+            {
+                for (const TimelinePoint &wait_point : submit_descriptor.wait_points)
+                {
+                    if (signaled_values[wait_point.queue_type] < wait_point.value)
+                    {
+                        this->report_validation_error(fmt::format("Timeline value {} is waited on but never signalled", wait_point.value));
+                    }
+                }
+            }
+        }
+
+        for (const SubmitDescriptor &submit_descriptor : submit_descriptors)
+        {
+            const std::shared_ptr<NullCommandList> command_list = std::dynamic_pointer_cast<NullCommandList>(submit_descriptor.command_list);
+            HE_ASSERT(command_list);
+
+            this->record_commands(command_list->statistics());
+        }
+
+        const std::lock_guard lock(m_statistics_mutex);
+
+        m_statistics.submit_count += 1;
+    }
+
+    void NullGraphicsDevice::present(const SurfaceHandle surface_handle) const
+    {
+        HE_UNUSED(surface_handle);
+
+        if (m_validation_enabled && !m_frame_active)
+        {
+            this->report_validation_error("Surface was presented outside of a frame");
+        }
+
+        m_frame_active = false;
+
+        const std::lock_guard lock(m_statistics_mutex);
+
+        m_statistics.frame_count += 1;
+    }
+
+    void NullGraphicsDevice::wait_for_idle() const
+    {
+    }
+
+    std::string_view NullGraphicsDevice::resource_type_name(const NullResourceType resource_type)
+    {
+        switch (resource_type)
+        {
+        case NullResourceType::Buffer:
+            return "Buffer";
+        case NullResourceType::CommandList:
+            return "Command List";
+        case NullResourceType::ComputePipeline:
+            return "Compute Pipeline";
+        case NullResourceType::GraphicsPipeline:
+            return "Graphics Pipeline";
+        case NullResourceType::MemoryHeap:
+            return "Memory Heap";
+        case NullResourceType::PipelineLayout:
+            return "Pipeline Layout";
+        case NullResourceType::ShaderModule:
+            return "Shader Module";
+        case NullResourceType::Texture:
+            return "Texture";
+        case NullResourceType::TextureView:
+            return "Texture View";
+        default:
+            HE_UNREACHABLE();
+        }
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_graphics_pipeline.hpp"
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    NullGraphicsPipeline::NullGraphicsPipeline(NullGraphicsDevice &graphics_device, const GraphicsPipelineDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_layout(descriptor.layout)
+    {
+        m_graphics_device.track_resource(NullResourceType::GraphicsPipeline);
+    }
+
+    NullGraphicsPipeline::~NullGraphicsPipeline()
+    {
+        m_graphics_device.untrack_resource(NullResourceType::GraphicsPipeline);
+    }
+} // namespace hyper_rhi
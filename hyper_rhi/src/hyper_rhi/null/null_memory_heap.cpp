@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_memory_heap.hpp"
+
+#include <hyper_core/assertion.hpp>
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    NullMemoryHeap::NullMemoryHeap(NullGraphicsDevice &graphics_device, const MemoryHeapDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_byte_size(descriptor.requirements.byte_size)
+    {
+        HE_ASSERT(m_byte_size > 0);
+
+        m_graphics_device.memory_budget().track_allocation(MemoryCategory::Transient, m_byte_size);
+        m_graphics_device.track_resource(NullResourceType::MemoryHeap);
+    }
+
+    NullMemoryHeap::~NullMemoryHeap()
+    {
+        m_graphics_device.memory_budget().untrack_allocation(MemoryCategory::Transient, m_byte_size);
+        m_graphics_device.untrack_resource(NullResourceType::MemoryHeap);
+    }
+
+    uint64_t NullMemoryHeap::byte_size() const
+    {
+        return m_byte_size;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_pipeline_layout.hpp"
+
+#include <hyper_core/prerequisites.hpp>
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    NullPipelineLayout::NullPipelineLayout(NullGraphicsDevice &graphics_device, const PipelineLayoutDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+    {
+        HE_UNUSED(descriptor);
+
+        m_graphics_device.track_resource(NullResourceType::PipelineLayout);
+    }
+
+    NullPipelineLayout::~NullPipelineLayout()
+    {
+        m_graphics_device.untrack_resource(NullResourceType::PipelineLayout);
+    }
+} // namespace hyper_rhi
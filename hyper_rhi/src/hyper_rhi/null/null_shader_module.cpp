@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_shader_module.hpp"
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+#include "hyper_rhi/object_cache.hpp"
+
+namespace hyper_rhi
+{
+    NullShaderModule::NullShaderModule(NullGraphicsDevice &graphics_device, const ShaderModuleDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_hash(hash_descriptor(descriptor))
+    {
+        m_graphics_device.track_resource(NullResourceType::ShaderModule);
+    }
+
+    NullShaderModule::~NullShaderModule()
+    {
+        m_graphics_device.untrack_resource(NullResourceType::ShaderModule);
+    }
+
+    uint64_t NullShaderModule::hash() const
+    {
+        return m_hash;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_surface.hpp"
+
+#include <fmt/format.h>
+
+#include <hyper_platform/window.hpp>
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+#include "hyper_rhi/null/null_texture.hpp"
+
+namespace hyper_rhi
+{
+    NullSurface::NullSurface(NullGraphicsDevice &graphics_device, const SurfaceDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_textures()
+        , m_current_texture_index(0)
+        , m_width(descriptor.window.width())
+        , m_height(descriptor.window.height())
+        , m_present_mode(descriptor.present_mode)
+    {
+        this->create_textures();
+    }
+
+    void NullSurface::acquire_next_texture()
+    {
+        m_current_texture_index = (m_current_texture_index + 1) % s_texture_count;
+    }
+
+    void NullSurface::resize(const uint32_t width, const uint32_t height)
+    {
+        m_width = width;
+        m_height = height;
+
+        this->create_textures();
+    }
+
+    void NullSurface::set_present_mode(const PresentMode present_mode)
+    {
+        m_present_mode = present_mode;
+    }
+
+    PresentMode NullSurface::present_mode() const
+    {
+        return m_present_mode;
+    }
+
+    TextureFormat NullSurface::format() const
+    {
+        return TextureFormat::B8G8R8A8Srgb;
+    }
+
+    TextureHandle NullSurface::current_texture() const
+    {
+        return m_textures[m_current_texture_index];
+    }
+
+    void NullSurface::create_textures()
+    {
+        m_textures.clear();
+        m_textures.reserve(s_texture_count);
+        for (uint32_t texture_index = 0; texture_index < s_texture_count; ++texture_index)
+        {
+            m_textures.push_back(std::make_shared<NullTexture>(
+                m_graphics_device,
+                TextureDescriptor{
+                    .label = fmt::format("Swapchain Texture #{}", texture_index),
+                    .width = m_width,
+                    .height = m_height,
+                    .depth = 1,
+                    .array_size = 1,
+                    .mip_levels = 1,
+                    .sample_count = 1,
+                    .sample_quality = 0,
+                    .format = this->format(),
+                    .dimension = TextureDimension::Texture2D,
+                    .is_render_attachment = true,
+                    .is_storage = false,
+                    .memory_heap = nullptr,
+                    .memory_heap_offset = 0,
+                }));
+        }
+    }
+} // namespace hyper_rhi
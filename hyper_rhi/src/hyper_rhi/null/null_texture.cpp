@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_texture.hpp"
+
+#include <fmt/format.h>
+
+#include <hyper_core/assertion.hpp>
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    static constexpr uint64_t s_texture_alignment = 64 * 1024;
+
+    NullTexture::NullTexture(NullGraphicsDevice &graphics_device, const TextureDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_format(descriptor.format)
+        , m_width(descriptor.width)
+        , m_height(descriptor.height)
+        , m_dimension(descriptor.dimension)
+        , m_mip_levels(descriptor.mip_levels)
+        , m_array_layers(descriptor.dimension == TextureDimension::Texture3D ? 1 : descriptor.array_size)
+        , m_is_storage(descriptor.is_storage)
+        , m_memory_heap(descriptor.memory_heap)
+        , m_allocation_byte_size(m_memory_heap ? 0 : NullTexture::memory_requirements(descriptor).byte_size)
+        , m_handle(m_graphics_device.descriptor_index_allocator().allocate())
+        , m_storage_handle(m_is_storage ? m_graphics_device.descriptor_index_allocator().allocate() : DescriptorIndexAllocator::s_invalid_index)
+    {
+        HE_ASSERT(descriptor.format != TextureFormat::Unknown);
+        HE_ASSERT(descriptor.dimension != TextureDimension::Unknown);
+        HE_ASSERT(m_handle.handle() != DescriptorIndexAllocator::s_invalid_index);
+
+        if (!m_memory_heap)
+        {
+            m_graphics_device.memory_budget().track_allocation(MemoryCategory::Texture, m_allocation_byte_size);
+        }
+
+        if (!m_graphics_device.validation_enabled())
+        {
+            m_graphics_device.track_resource(NullResourceType::Texture);
+            return;
+        }
+
+        if (texture_format_compressed(descriptor.format) && (descriptor.is_render_attachment || descriptor.is_storage))
+        {
+            m_graphics_device.report_validation_error(
+                fmt::format("Compressed texture '{}' can't be rendered to or written as storage", descriptor.label));
+        }
+
+        if (m_memory_heap && descriptor.memory_heap_offset + NullTexture::memory_requirements(descriptor).byte_size > m_memory_heap->byte_size())
+        {
+            m_graphics_device.report_validation_error(fmt::format(
+                "Texture '{}' placed at offset {} exceeds its memory heap of {} bytes",
+                descriptor.label,
+                descriptor.memory_heap_offset,
+                m_memory_heap->byte_size()));
+        }
+
+        m_graphics_device.track_resource(NullResourceType::Texture);
+    }
+
+    NullTexture::~NullTexture()
+    {
+        m_graphics_device.descriptor_index_allocator().free(m_handle.handle());
+        if (m_is_storage)
+        {
+            m_graphics_device.descriptor_index_allocator().free(m_storage_handle.handle());
+        }
+
+        if (!m_memory_heap)
+        {
+            m_graphics_device.memory_budget().untrack_allocation(MemoryCategory::Texture, m_allocation_byte_size);
+        }
+
+        m_graphics_device.untrack_resource(NullResourceType::Texture);
+    }
+
+    MemoryRequirements NullTexture::memory_requirements(const TextureDescriptor &descriptor)
+    {
+        const uint64_t byte_size = texture_byte_size(descriptor);
+
+        return {
+            .byte_size = (byte_size + s_texture_alignment - 1) & ~(s_texture_alignment - 1),
+            .alignment = s_texture_alignment,
+            .memory_types = ~0u,
+        };
+    }
+
+    TextureDimension NullTexture::dimension() const
+    {
+        return m_dimension;
+    }
+
+    uint32_t NullTexture::mip_levels() const
+    {
+        return m_mip_levels;
+    }
+
+    uint32_t NullTexture::array_layers() const
+    {
+        return m_array_layers;
+    }
+
+    bool NullTexture::is_storage() const
+    {
+        return m_is_storage;
+    }
+
+    TextureFormat NullTexture::format() const
+    {
+        return m_format;
+    }
+
+    uint32_t NullTexture::width() const
+    {
+        return m_width;
+    }
+
+    uint32_t NullTexture::height() const
+    {
+        return m_height;
+    }
+
+    ResourceHandle NullTexture::handle() const
+    {
+        return m_handle;
+    }
+
+    ResourceHandle NullTexture::storage_handle() const
+    {
+        return m_storage_handle;
+    }
+} // namespace hyper_rhi
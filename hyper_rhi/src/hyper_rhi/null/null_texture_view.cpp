@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/null/null_texture_view.hpp"
+
+#include <fmt/format.h>
+
+#include <hyper_core/assertion.hpp>
+
+#include "hyper_rhi/null/null_graphics_device.hpp"
+#include "hyper_rhi/null/null_texture.hpp"
+
+namespace hyper_rhi
+{
+    NullTextureView::NullTextureView(NullGraphicsDevice &graphics_device, const TextureViewDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_texture(descriptor.texture)
+        , m_is_storage(false)
+        , m_handle(m_graphics_device.descriptor_index_allocator().allocate())
+        , m_storage_handle(DescriptorIndexAllocator::s_invalid_index)
+    {
+        HE_ASSERT(m_texture);
+        HE_ASSERT(m_handle.handle() != DescriptorIndexAllocator::s_invalid_index);
+
+        const std::shared_ptr<NullTexture> texture = std::dynamic_pointer_cast<NullTexture>(m_texture);
+        HE_ASSERT(texture);
+
+        m_is_storage = texture->is_storage() && descriptor.mip_level_count == 1;
+        if (m_is_storage)
+        {
+            m_storage_handle = ResourceHandle(m_graphics_device.descriptor_index_allocator().allocate());
+        }
+
+        if (m_graphics_device.validation_enabled() &&
+            (descriptor.mip_level_count == 0 || descriptor.array_layer_count == 0 ||
+             descriptor.base_mip_level + descriptor.mip_level_count > texture->mip_levels() ||
+             descriptor.base_array_layer + descriptor.array_layer_count > texture->array_layers()))
+        {
+            m_graphics_device.report_validation_error(fmt::format(
+                "Texture view '{}' of mips {}..{} and layers {}..{} exceeds its texture of {} mips and {} layers",
+                descriptor.label,
+                descriptor.base_mip_level,
+                descriptor.base_mip_level + descriptor.mip_level_count,
+                descriptor.base_array_layer,
+                descriptor.base_array_layer + descriptor.array_layer_count,
+                texture->mip_levels(),
+                texture->array_layers()));
+        }
+
+        m_graphics_device.track_resource(NullResourceType::TextureView);
+    }
+
+    NullTextureView::~NullTextureView()
+    {
+        m_graphics_device.descriptor_index_allocator().free(m_handle.handle());
+        if (m_is_storage)
+        {
+            m_graphics_device.descriptor_index_allocator().free(m_storage_handle.handle());
+        }
+
+        m_graphics_device.untrack_resource(NullResourceType::TextureView);
+    }
+
+    ResourceHandle NullTextureView::handle() const
+    {
+        return m_handle;
+    }
+
+    ResourceHandle NullTextureView::storage_handle() const
+    {
+        return m_storage_handle;
+    }
+} // namespace hyper_rhi
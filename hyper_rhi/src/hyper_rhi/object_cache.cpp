@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/object_cache.hpp"
+
+#include <hyper_core/hash.hpp>
+#include <hyper_core/logger.hpp>
+
+namespace hyper_rhi
+{
+    // NOTE: Layouts are keyed by identity, every pipeline keeps its layout alive so the address can't be reused while the entry lives
+    static uint64_t hash_layout(const PipelineLayout *layout)
+    {
+        return reinterpret_cast<uint64_t>(layout);
+    }
+
+    static uint64_t hash_shader(const ShaderModuleHandle &shader)
+    {
+        return shader ? shader->hash() : 0;
+    }
+
+    uint64_t hash_descriptor(const ShaderModuleDescriptor &descriptor)
+    {
+        uint64_t hash = hyper_core::hash::fnv1a(descriptor.bytes);
+        hash = hyper_core::hash::combine(hash, static_cast<uint64_t>(descriptor.type));
+        hash = hyper_core::hash::combine(hash, hyper_core::hash::fnv1a(descriptor.entry_name));
+        return hash;
+    }
+
+    ComputePipelineKey object_key(const ComputePipelineDescriptor &descriptor)
+    {
+        return {
+            .layout = descriptor.layout.get(),
+            .shader = hash_shader(descriptor.shader),
+        };
+    }
+
+    GraphicsPipelineKey object_key(const GraphicsPipelineDescriptor &descriptor)
+    {
+        return {
+            .layout = descriptor.layout.get(),
+            .vertex_shader = hash_shader(descriptor.vertex_shader),
+            .fragment_shader = hash_shader(descriptor.fragment_shader),
+            .color_attachment_format = descriptor.color_attachment_format,
+            .depth_attachment_format = descriptor.depth_attachment_format,
+        };
+    }
+
+    uint64_t hash_key(const ComputePipelineKey &key)
+    {
+        uint64_t hash = hash_layout(key.layout);
+        hash = hyper_core::hash::combine(hash, key.shader);
+        return hash;
+    }
+
+    uint64_t hash_key(const GraphicsPipelineKey &key)
+    {
+        uint64_t hash = hash_layout(key.layout);
+        hash = hyper_core::hash::combine(hash, key.vertex_shader);
+        hash = hyper_core::hash::combine(hash, key.fragment_shader);
+        hash = hyper_core::hash::combine(hash, static_cast<uint64_t>(key.color_attachment_format));
+        hash = hyper_core::hash::combine(hash, static_cast<uint64_t>(key.depth_attachment_format));
+        return hash;
+    }
+
+    void log_statistics(const std::string_view name, const ObjectCacheStatistics &statistics)
+    {
+        const uint64_t request_count = statistics.hit_count + statistics.miss_count;
+        const double dedup_ratio = request_count > 0 ? static_cast<double>(statistics.hit_count) / static_cast<double>(request_count) : 0.0;
+
+        HE_INFO(
+            "{} cache: {} hits, {} misses ({:.1f}% deduplicated), {} live entries with {} references",
+            name,
+            statistics.hit_count,
+            statistics.miss_count,
+            dedup_ratio * 100.0,
+            statistics.entry_count,
+            statistics.reference_count);
+    }
+} // namespace hyper_rhi
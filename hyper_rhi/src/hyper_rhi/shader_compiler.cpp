@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/shader_compiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+#if HE_WINDOWS
+#    include <atlbase.h>
+#endif
+
+#include <dxcapi.h>
+#include <fmt/format.h>
+
+#include <hyper_core/assertion.hpp>
+#include <hyper_core/filesystem.hpp>
+#include <hyper_core/hash.hpp>
+#include <hyper_core/logger.hpp>
+#include <hyper_core/prerequisites.hpp>
+
+namespace hyper_rhi
+{
+    static constexpr uint32_t s_cache_magic = 0x43534548;
+    static constexpr uint32_t s_cache_version = 1;
+
+    class ShaderIncludeHandler final : public IDxcIncludeHandler
+    {
+    public:
+        ShaderIncludeHandler(IDxcUtils *utils, std::vector<std::string> &include_paths)
+            : m_utils(utils)
+            , m_include_paths(include_paths)
+        {
+        }
+
+        HRESULT STDMETHODCALLTYPE LoadSource(LPCWSTR file_name, IDxcBlob **include_source) override
+        {
+            const std::string include_path = std::filesystem::path(file_name).lexically_normal().generic_string();
+
+            CComPtr<IDxcBlobEncoding> source = nullptr;
+            const HRESULT result = m_utils->LoadFile(file_name, nullptr, &source);
+            if (FAILED(result))
+            {
+                HE_ERROR("Failed to open shader include '{}'", include_path);
+                return result;
+            }
+
+            if (std::find(m_include_paths.begin(), m_include_paths.end(), include_path) == m_include_paths.end())
+            {
+                m_include_paths.push_back(include_path);
+            }
+
+            *include_source = source.Detach();
+            return S_OK;
+        }
+
+        // NOTE: The handler lives on the stack for the duration of a single compilation, so reference counting is a no-op
+        HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void **object) override
+        {
+            HE_UNUSED(riid);
+
+            *object = nullptr;
+            return E_NOINTERFACE;
+        }
+
+        ULONG STDMETHODCALLTYPE AddRef() override
+        {
+            return 1;
+        }
+
+        ULONG STDMETHODCALLTYPE Release() override
+        {
+            return 1;
+        }
+
+    private:
+        IDxcUtils *m_utils;
+        std::vector<std::string> &m_include_paths;
+    };
+
+    static const wchar_t *shader_type_to_profile(const ShaderType type)
+    {
+        switch (type)
+        {
+        case ShaderType::Compute:
+            return L"cs_6_6";
+        case ShaderType::Fragment:
+            return L"ps_6_6";
+        case ShaderType::Vertex:
+            return L"vs_6_6";
+        case ShaderType::None:
+        default:
+            HE_UNREACHABLE();
+        }
+    }
+
+    ShaderCompiler::ShaderCompiler(const ShaderCompilerDescriptor &descriptor)
+        : m_cache_directory(descriptor.cache_directory)
+        , m_compiler_version(0)
+    {
+        std::error_code error_code;
+        std::filesystem::create_directories(m_cache_directory, error_code);
+        if (error_code)
+        {
+            HE_WARN("Failed to create shader cache directory '{}': {}", m_cache_directory, error_code.message());
+        }
+
+        CComPtr<IDxcVersionInfo> version_info = nullptr;
+        if (SUCCEEDED(DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&version_info))))
+        {
+            uint32_t major = 0;
+            uint32_t minor = 0;
+            version_info->GetVersion(&major, &minor);
+
+            m_compiler_version = (static_cast<uint64_t>(major) << 32) | static_cast<uint64_t>(minor);
+        }
+
+        HE_INFO("Created Shader Compiler with cache at '{}'", m_cache_directory);
+    }
+
+    std::optional<ShaderCompilationResult> ShaderCompiler::compile(const ShaderCompilationDescriptor &descriptor) const
+    {
+        const std::vector<uint8_t> source = hyper_core::filesystem::read_file(descriptor.file_path);
+        if (source.empty())
+        {
+            HE_ERROR("Failed to read shader '{}'", descriptor.file_path);
+            return std::nullopt;
+        }
+
+        // NOTE: The cooker and the runtime reach the same file through different relative paths, both have to hash to the same key
+        std::error_code error_code;
+        std::filesystem::path normalized_file_path = std::filesystem::weakly_canonical(descriptor.file_path, error_code);
+        if (error_code)
+        {
+            normalized_file_path = std::filesystem::path(descriptor.file_path).lexically_normal();
+        }
+
+        const std::string normalized_path = normalized_file_path.generic_string();
+
+        uint64_t request_hash = hyper_core::hash::fnv1a(normalized_path);
+        request_hash = hyper_core::hash::combine(request_hash, hyper_core::hash::fnv1a(descriptor.entry_name));
+        request_hash = hyper_core::hash::combine(request_hash, static_cast<uint64_t>(descriptor.type));
+        request_hash = hyper_core::hash::combine(request_hash, static_cast<uint64_t>(descriptor.graphics_api));
+        request_hash = hyper_core::hash::combine(request_hash, m_compiler_version);
+        for (const std::string &define : descriptor.defines)
+        {
+            request_hash = hyper_core::hash::combine(request_hash, hyper_core::hash::fnv1a(define));
+        }
+
+        const uint64_t source_hash = hyper_core::hash::combine(request_hash, hyper_core::hash::fnv1a(source));
+        const std::string cache_path = fmt::format("{}/{:016x}.bin", m_cache_directory, request_hash);
+
+        if (std::optional<ShaderCompilationResult> cached_result = ShaderCompiler::load_cached(cache_path, source_hash))
+        {
+            HE_TRACE("Loaded shader '{}:{}' from cache", descriptor.file_path, descriptor.entry_name);
+            return cached_result;
+        }
+
+        std::optional<ShaderCompilationResult> result = this->compile_source(descriptor, source);
+        if (!result)
+        {
+            return std::nullopt;
+        }
+
+        ShaderCompiler::store_cached(cache_path, *result, source_hash);
+
+        HE_INFO("Compiled shader '{}:{}'", descriptor.file_path, descriptor.entry_name);
+
+        return result;
+    }
+
+    const std::string &ShaderCompiler::cache_directory() const
+    {
+        return m_cache_directory;
+    }
+
+    std::optional<ShaderCompilationResult> ShaderCompiler::compile_source(
+        const ShaderCompilationDescriptor &descriptor,
+        const std::vector<uint8_t> &source) const
+    {
+        CComPtr<IDxcUtils> utils = nullptr;
+        CComPtr<IDxcCompiler3> compiler = nullptr;
+        if (FAILED(DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&utils))) ||
+            FAILED(DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&compiler))))
+        {
+            HE_ERROR("Failed to create DXC instance for shader '{}'", descriptor.file_path);
+            return std::nullopt;
+        }
+
+        const std::filesystem::path file_path = descriptor.file_path;
+
+        std::vector<std::wstring> arguments = {
+            file_path.wstring(),
+            L"-E",
+            std::filesystem::path(descriptor.entry_name).wstring(),
+            L"-T",
+            shader_type_to_profile(descriptor.type),
+            L"-I",
+            file_path.parent_path().wstring(),
+            L"-HV",
+            L"2021",
+            L"-O3",
+        };
+
+        if (descriptor.graphics_api == GraphicsApi::Vulkan)
+        {
+            arguments.emplace_back(L"-spirv");
+            arguments.emplace_back(L"-fspv-target-env=vulkan1.3");
+            arguments.emplace_back(L"-D");
+            arguments.emplace_back(L"HE_VULKAN");
+        }
+
+        for (const std::string &define : descriptor.defines)
+        {
+            arguments.emplace_back(L"-D");
+            arguments.emplace_back(std::filesystem::path(define).wstring());
+        }
+
+        std::vector<LPCWSTR> argument_pointers;
+        argument_pointers.reserve(arguments.size());
+        for (const std::wstring &argument : arguments)
+        {
+            argument_pointers.push_back(argument.c_str());
+        }
+
+        const DxcBuffer source_buffer = {
+            .Ptr = source.data(),
+            .Size = source.size(),
+            .Encoding = DXC_CP_UTF8,
+        };
+
+        ShaderCompilationResult result = {};
+        ShaderIncludeHandler include_handler(utils, result.include_paths);
+
+        CComPtr<IDxcResult> compile_result = nullptr;
+        if (FAILED(compiler->Compile(
+                &source_buffer,
+                argument_pointers.data(),
+                static_cast<uint32_t>(argument_pointers.size()),
+                &include_handler,
+                IID_PPV_ARGS(&compile_result))))
+        {
+            HE_ERROR("Failed to invoke DXC for shader '{}'", descriptor.file_path);
+            return std::nullopt;
+        }
+
+        HRESULT status = S_OK;
+        compile_result->GetStatus(&status);
+
+        CComPtr<IDxcBlobUtf8> errors = nullptr;
+        compile_result->GetOutput(DXC_OUT_ERRORS, IID_PPV_ARGS(&errors), nullptr);
+
+        if (FAILED(status))
+        {
+            HE_ERROR(
+                "Failed to compile shader '{}:{}':\n{}",
+                descriptor.file_path,
+                descriptor.entry_name,
+                errors != nullptr ? errors->GetStringPointer() : "");
+            return std::nullopt;
+        }
+
+        if (errors != nullptr && errors->GetStringLength() > 0)
+        {
+            HE_WARN("Shader '{}:{}' compiled with warnings:\n{}", descriptor.file_path, descriptor.entry_name, errors->GetStringPointer());
+        }
+
+        CComPtr<IDxcBlob> object = nullptr;
+        compile_result->GetOutput(DXC_OUT_OBJECT, IID_PPV_ARGS(&object), nullptr);
+        if (object == nullptr || object->GetBufferSize() == 0)
+        {
+            HE_ERROR("DXC produced no bytecode for shader '{}:{}'", descriptor.file_path, descriptor.entry_name);
+            return std::nullopt;
+        }
+
+        const uint8_t *object_data = static_cast<const uint8_t *>(object->GetBufferPointer());
+        result.bytes.assign(object_data, object_data + object->GetBufferSize());
+
+        return result;
+    }
+
+    // NOTE: Layout is magic, version, content hash, include count, [include path length, include path], bytecode size, bytecode
+    std::optional<ShaderCompilationResult> ShaderCompiler::load_cached(const std::string &cache_path, const uint64_t source_hash)
+    {
+        const std::vector<uint8_t> data = hyper_core::filesystem::read_file(cache_path);
+
+        size_t offset = 0;
+        const auto read = [&data, &offset](void *destination, const size_t byte_size)
+        {
+            if (offset + byte_size > data.size())
+            {
+                return false;
+            }
+
+            std::memcpy(destination, data.data() + offset, byte_size);
+            offset += byte_size;
+            return true;
+        };
+
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint64_t content_hash = 0;
+        uint32_t include_count = 0;
+        if (!read(&magic, sizeof(magic)) || !read(&version, sizeof(version)) || !read(&content_hash, sizeof(content_hash)) ||
+            !read(&include_count, sizeof(include_count)))
+        {
+            return std::nullopt;
+        }
+
+        if (magic != s_cache_magic || version != s_cache_version)
+        {
+            return std::nullopt;
+        }
+
+        ShaderCompilationResult result = {
+            .bytes = {},
+            .include_paths = {},
+            .cached = true,
+        };
+
+        for (uint32_t index = 0; index < include_count; ++index)
+        {
+            uint32_t length = 0;
+            if (!read(&length, sizeof(length)))
+            {
+                return std::nullopt;
+            }
+
+            std::string include_path(length, '\0');
+            if (!read(include_path.data(), length))
+            {
+                return std::nullopt;
+            }
+
+            result.include_paths.push_back(std::move(include_path));
+        }
+
+        // NOTE: Includes are rehashed from disk, so touching any of them invalidates the entry
+        if (ShaderCompiler::hash_content(source_hash, result.include_paths) != content_hash)
+        {
+            return std::nullopt;
+        }
+
+        uint64_t byte_size = 0;
+        if (!read(&byte_size, sizeof(byte_size)) || offset + byte_size != data.size())
+        {
+            return std::nullopt;
+        }
+
+        result.bytes.assign(data.begin() + static_cast<std::ptrdiff_t>(offset), data.end());
+
+        return result;
+    }
+
+    void ShaderCompiler::store_cached(const std::string &cache_path, const ShaderCompilationResult &result, const uint64_t source_hash)
+    {
+        std::vector<uint8_t> data;
+        const auto write = [&data](const void *source, const size_t byte_size)
+        {
+            const uint8_t *bytes = static_cast<const uint8_t *>(source);
+            data.insert(data.end(), bytes, bytes + byte_size);
+        };
+
+        const uint64_t content_hash = ShaderCompiler::hash_content(source_hash, result.include_paths);
+        const uint32_t include_count = static_cast<uint32_t>(result.include_paths.size());
+        write(&s_cache_magic, sizeof(s_cache_magic));
+        write(&s_cache_version, sizeof(s_cache_version));
+        write(&content_hash, sizeof(content_hash));
+        write(&include_count, sizeof(include_count));
+
+        for (const std::string &include_path : result.include_paths)
+        {
+            const uint32_t length = static_cast<uint32_t>(include_path.size());
+            write(&length, sizeof(length));
+            write(include_path.data(), length);
+        }
+
+        const uint64_t byte_size = result.bytes.size();
+        write(&byte_size, sizeof(byte_size));
+        write(result.bytes.data(), result.bytes.size());
+
+        if (!hyper_core::filesystem::write_file(cache_path, data))
+        {
+            HE_WARN("Failed to write shader cache entry '{}'", cache_path);
+        }
+    }
+
+    uint64_t ShaderCompiler::hash_content(const uint64_t source_hash, const std::vector<std::string> &include_paths)
+    {
+        uint64_t content_hash = source_hash;
+        for (const std::string &include_path : include_paths)
+        {
+            content_hash = hyper_core::hash::combine(content_hash, hyper_core::hash::fnv1a(include_path));
+            content_hash = hyper_core::hash::combine(content_hash, hyper_core::hash::fnv1a(hyper_core::filesystem::read_file(include_path)));
+        }
+
+        return content_hash;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_buffer.hpp"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_memory_heap.hpp"
+
+namespace hyper_rhi
+{
+    VulkanBuffer::VulkanBuffer(VulkanGraphicsDevice &graphics_device, const BufferDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_byte_size(descriptor.byte_size)
+        , m_memory_location(descriptor.memory_location)
+        , m_buffer(VK_NULL_HANDLE)
+        , m_allocation(VK_NULL_HANDLE)
+        , m_memory_heap(descriptor.memory_heap)
+        , m_mapped_data(nullptr)
+        , m_device_address(0)
+        , m_handle(std::numeric_limits<uint32_t>::max())
+    {
+        HE_ASSERT(m_byte_size > 0);
+
+        const VkBufferCreateInfo buffer_create_info = VulkanBuffer::buffer_create_info(m_graphics_device, descriptor);
+
+        if (m_memory_heap)
+        {
+            // NOTE: Placed buffers live in device local heaps, they are never mapped
+            HE_ASSERT(m_memory_location == MemoryLocation::GpuOnly);
+
+            const std::shared_ptr<VulkanMemoryHeap> memory_heap = std::dynamic_pointer_cast<VulkanMemoryHeap>(m_memory_heap);
+            HE_VK_CHECK(vmaCreateAliasingBuffer2(
+                m_graphics_device.allocator(), memory_heap->allocation(), descriptor.memory_heap_offset, &buffer_create_info, &m_buffer));
+            HE_ASSERT(m_buffer != VK_NULL_HANDLE);
+        }
+        else
+        {
+            const VmaAllocationCreateInfo allocation_create_info = VulkanBuffer::allocation_create_info(m_memory_location);
+
+            VmaAllocationInfo allocation_info = {};
+            HE_VK_CHECK(vmaCreateBuffer(
+                m_graphics_device.allocator(), &buffer_create_info, &allocation_create_info, &m_buffer, &m_allocation, &allocation_info));
+            HE_ASSERT(m_buffer != VK_NULL_HANDLE);
+            HE_ASSERT(m_allocation != VK_NULL_HANDLE);
+
+            m_mapped_data = static_cast<uint8_t *>(allocation_info.pMappedData);
+
+            m_graphics_device.memory_budget().track_allocation(MemoryCategory::Buffer, allocation_info.size);
+
+            if (m_memory_location == MemoryLocation::GpuUpload)
+            {
+                VkMemoryPropertyFlags memory_property_flags = 0;
+                vmaGetAllocationMemoryProperties(m_graphics_device.allocator(), m_allocation, &memory_property_flags);
+
+                if ((memory_property_flags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT) == 0)
+                {
+                    HE_DEBUG("No device local host visible memory available for '{}', falling back to host memory", descriptor.label);
+                }
+            }
+
+            vmaSetAllocationName(m_graphics_device.allocator(), m_allocation, descriptor.label.c_str());
+        }
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<uint64_t>(m_buffer), descriptor.label);
+
+        if (descriptor.is_device_addressable)
+        {
+            const VkBufferDeviceAddressInfo buffer_device_address_info = {
+                .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+                .pNext = nullptr,
+                .buffer = m_buffer,
+            };
+            m_device_address = vkGetBufferDeviceAddress(m_graphics_device.device(), &buffer_device_address_info);
+        }
+        else
+        {
+            m_handle = m_graphics_device.descriptor_manager().allocate_buffer_handle(m_buffer, m_byte_size);
+        }
+
+        HE_TRACE("Created Buffer '{}' with {} bytes", descriptor.label, m_byte_size);
+    }
+
+    VulkanBuffer::~VulkanBuffer()
+    {
+        if (m_handle.handle() != std::numeric_limits<uint32_t>::max())
+        {
+            m_graphics_device.descriptor_manager().retire_handle(DescriptorHeapType::StorageBuffer, m_handle);
+        }
+
+        if (m_allocation != VK_NULL_HANDLE)
+        {
+            VmaAllocationInfo allocation_info = {};
+            vmaGetAllocationInfo(m_graphics_device.allocator(), m_allocation, &allocation_info);
+
+            m_graphics_device.memory_budget().untrack_allocation(MemoryCategory::Buffer, allocation_info.size);
+        }
+
+        // NOTE: Placed buffers only own the buffer, the heap memory is released with the heap
+        m_graphics_device.deletion_queue().enqueue(
+            [device = m_graphics_device.device(), allocator = m_graphics_device.allocator(), buffer = m_buffer, allocation = m_allocation]()
+            {
+                if (allocation == VK_NULL_HANDLE)
+                {
+                    vkDestroyBuffer(device, buffer, nullptr);
+                    return;
+                }
+
+                vmaDestroyBuffer(allocator, buffer, allocation);
+            });
+    }
+
+    MemoryRequirements VulkanBuffer::memory_requirements(const VulkanGraphicsDevice &graphics_device, const BufferDescriptor &descriptor)
+    {
+        const VkBufferCreateInfo buffer_create_info = VulkanBuffer::buffer_create_info(graphics_device, descriptor);
+
+        const VkDeviceBufferMemoryRequirements device_buffer_memory_requirements = {
+            .sType = VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS,
+            .pNext = nullptr,
+            .pCreateInfo = &buffer_create_info,
+        };
+
+        VkMemoryRequirements2 memory_requirements = {
+            .sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+            .pNext = nullptr,
+            .memoryRequirements = {},
+        };
+        vkGetDeviceBufferMemoryRequirements(graphics_device.device(), &device_buffer_memory_requirements, &memory_requirements);
+
+        return {
+            .byte_size = memory_requirements.memoryRequirements.size,
+            .alignment = memory_requirements.memoryRequirements.alignment,
+            .memory_types = memory_requirements.memoryRequirements.memoryTypeBits,
+        };
+    }
+
+    VkBuffer VulkanBuffer::buffer() const
+    {
+        return m_buffer;
+    }
+
+    VmaAllocation VulkanBuffer::allocation() const
+    {
+        return m_allocation;
+    }
+
+    uint64_t VulkanBuffer::byte_size() const
+    {
+        return m_byte_size;
+    }
+
+    MemoryLocation VulkanBuffer::memory_location() const
+    {
+        return m_memory_location;
+    }
+
+    uint8_t *VulkanBuffer::mapped_data() const
+    {
+        return m_mapped_data;
+    }
+
+    uint64_t VulkanBuffer::device_address() const
+    {
+        return m_device_address;
+    }
+
+    ResourceHandle VulkanBuffer::handle() const
+    {
+        return m_handle;
+    }
+
+    VkBufferCreateInfo VulkanBuffer::buffer_create_info(const VulkanGraphicsDevice &graphics_device, const BufferDescriptor &descriptor)
+    {
+        VkBufferUsageFlags usage_flags =
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        if (descriptor.is_index_buffer)
+        {
+            usage_flags |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+        }
+
+        if (descriptor.is_constant_buffer)
+        {
+            usage_flags |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+        }
+
+        if (descriptor.is_argument_buffer)
+        {
+            usage_flags |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+        }
+
+        // NOTE: Descriptor buffers reference storage buffers through their device address as well
+        if (descriptor.is_device_addressable || graphics_device.descriptor_buffer_supported())
+        {
+            usage_flags |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+        }
+
+        // NOTE: Buffers are shared between the graphics, compute and transfer queues without ownership transfers
+        const std::vector<uint32_t> &queue_family_indices = graphics_device.queue_family_indices();
+        const bool concurrent = queue_family_indices.size() > 1;
+
+        const VkBufferCreateInfo buffer_create_info = {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = descriptor.byte_size,
+            .usage = usage_flags,
+            .sharingMode = concurrent ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = concurrent ? static_cast<uint32_t>(queue_family_indices.size()) : 0,
+            .pQueueFamilyIndices = concurrent ? queue_family_indices.data() : nullptr,
+        };
+
+        return buffer_create_info;
+    }
+
+    VmaAllocationCreateInfo VulkanBuffer::allocation_create_info(const MemoryLocation memory_location)
+    {
+        const auto [usage, flags] = [&memory_location]() -> std::pair<VmaMemoryUsage, VmaAllocationCreateFlags>
+        {
+            switch (memory_location)
+            {
+            case MemoryLocation::GpuOnly:
+                return { VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE, 0 };
+            case MemoryLocation::Upload:
+                return {
+                    VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+                    VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+                };
+            case MemoryLocation::Readback:
+                return {
+                    VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+                    VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+                };
+            case MemoryLocation::GpuUpload:
+                return {
+                    VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE,
+                    VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+                };
+            default:
+                HE_UNREACHABLE();
+            }
+        }();
+
+        // NOTE: Mapped buffers are written and read through their pointer without explicit flushes or invalidations
+        const VkMemoryPropertyFlags required_flags = memory_location != MemoryLocation::GpuOnly ? VK_MEMORY_PROPERTY_HOST_COHERENT_BIT : 0;
+
+        VkMemoryPropertyFlags preferred_flags = 0;
+        if (memory_location == MemoryLocation::GpuUpload)
+        {
+            preferred_flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+        }
+        else if (memory_location == MemoryLocation::Readback)
+        {
+            preferred_flags = VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+        }
+
+        const VmaAllocationCreateInfo allocation_create_info = {
+            .flags = flags,
+            .usage = usage,
+            .requiredFlags = required_flags,
+            .preferredFlags = preferred_flags,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
+            .priority = 0.0f,
+        };
+
+        return allocation_create_info;
+    }
+} // namespace hyper_rhi
@@ -6,20 +6,40 @@
 
 #include "hyper_rhi/vulkan/vulkan_command_list.hpp"
 
+#include <vector>
+
+#include "hyper_rhi/vulkan/vulkan_buffer.hpp"
 #include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_graphics_pipeline.hpp"
+#include "hyper_rhi/vulkan/vulkan_texture.hpp"
+#include "hyper_rhi/vulkan/vulkan_utils.hpp"
 
 namespace hyper_rhi
 {
-    VulkanCommandList::VulkanCommandList(VulkanGraphicsDevice &graphics_device)
+    static_assert(sizeof(DrawIndexedIndirectArguments) == sizeof(VkDrawIndexedIndirectCommand));
+
+    VulkanCommandList::VulkanCommandList(VulkanGraphicsDevice &graphics_device, const CommandListDescriptor &descriptor)
         : m_graphics_device(graphics_device)
+        , m_queue_type(descriptor.queue_type)
+        , m_command_buffer(VK_NULL_HANDLE)
+        , m_pipeline_layout(VK_NULL_HANDLE)
+        , m_gpu_scopes()
     {
     }
 
-    void VulkanCommandList::begin() const
+    VkCommandBuffer VulkanCommandList::command_buffer() const
     {
-        const VkCommandBuffer &command_buffer = m_graphics_device.current_frame().command_buffer;
+        return m_command_buffer;
+    }
 
-        vkResetCommandBuffer(command_buffer, 0);
+    QueueType VulkanCommandList::queue_type() const
+    {
+        return m_queue_type;
+    }
+
+    void VulkanCommandList::begin()
+    {
+        m_command_buffer = m_graphics_device.command_pool(m_queue_type).acquire();
 
         constexpr VkCommandBufferBeginInfo command_buffer_begin_info = {
             .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
@@ -27,13 +47,242 @@ namespace hyper_rhi
             .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
             .pInheritanceInfo = nullptr,
         };
-        vkBeginCommandBuffer(command_buffer, &command_buffer_begin_info);
+        HE_VK_CHECK(vkBeginCommandBuffer(m_command_buffer, &command_buffer_begin_info));
+
+        m_pipeline_layout = VK_NULL_HANDLE;
+
+        m_graphics_device.descriptor_manager().bind(m_command_buffer, m_queue_type);
+    }
+
+    void VulkanCommandList::end()
+    {
+        HE_ASSERT(m_gpu_scopes.empty(), "Command list ended with {} open GPU scopes", m_gpu_scopes.size());
+
+        HE_VK_CHECK(vkEndCommandBuffer(m_command_buffer));
+    }
+
+    void VulkanCommandList::barrier(const std::span<const BufferBarrier> buffer_barriers, const std::span<const TextureBarrier> texture_barriers)
+    {
+        if (buffer_barriers.empty() && texture_barriers.empty())
+        {
+            return;
+        }
+
+        std::vector<VkBufferMemoryBarrier2> buffer_memory_barriers;
+        buffer_memory_barriers.reserve(buffer_barriers.size());
+        for (const BufferBarrier &buffer_barrier : buffer_barriers)
+        {
+            const std::shared_ptr<VulkanBuffer> buffer = std::dynamic_pointer_cast<VulkanBuffer>(buffer_barrier.buffer);
+            HE_ASSERT(buffer);
+
+            const VulkanResourceState state_before = resource_state_to_vulkan(buffer_barrier.state_before);
+            const VulkanResourceState state_after = resource_state_to_vulkan(buffer_barrier.state_after);
+
+            buffer_memory_barriers.push_back({
+                .sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2,
+                .pNext = nullptr,
+                .srcStageMask = state_before.stage_mask,
+                .srcAccessMask = state_before.access_mask,
+                .dstStageMask = state_after.stage_mask,
+                .dstAccessMask = state_after.access_mask,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .buffer = buffer->buffer(),
+                .offset = 0,
+                .size = VK_WHOLE_SIZE,
+            });
+        }
+
+        std::vector<VkImageMemoryBarrier2> image_memory_barriers;
+        image_memory_barriers.reserve(texture_barriers.size());
+        for (const TextureBarrier &texture_barrier : texture_barriers)
+        {
+            const std::shared_ptr<VulkanTexture> texture = std::dynamic_pointer_cast<VulkanTexture>(texture_barrier.texture);
+            HE_ASSERT(texture);
+
+            const VulkanResourceState state_before = resource_state_to_vulkan(texture_barrier.state_before);
+            const VulkanResourceState state_after = resource_state_to_vulkan(texture_barrier.state_after);
+
+            image_memory_barriers.push_back({
+                .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2,
+                .pNext = nullptr,
+                .srcStageMask = state_before.stage_mask,
+                .srcAccessMask = state_before.access_mask,
+                .dstStageMask = state_after.stage_mask,
+                .dstAccessMask = state_after.access_mask,
+                .oldLayout = state_before.image_layout,
+                .newLayout = state_after.image_layout,
+                .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+                .image = texture->image(),
+                .subresourceRange =
+                    {
+                        .aspectMask = texture->aspect_mask(),
+                        .baseMipLevel = 0,
+                        .levelCount = VK_REMAINING_MIP_LEVELS,
+                        .baseArrayLayer = 0,
+                        .layerCount = VK_REMAINING_ARRAY_LAYERS,
+                    },
+            });
+        }
+
+        const VkDependencyInfo dependency_info = {
+            .sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+            .pNext = nullptr,
+            .dependencyFlags = 0,
+            .memoryBarrierCount = 0,
+            .pMemoryBarriers = nullptr,
+            .bufferMemoryBarrierCount = static_cast<uint32_t>(buffer_memory_barriers.size()),
+            .pBufferMemoryBarriers = buffer_memory_barriers.data(),
+            .imageMemoryBarrierCount = static_cast<uint32_t>(image_memory_barriers.size()),
+            .pImageMemoryBarriers = image_memory_barriers.data(),
+        };
+        vkCmdPipelineBarrier2(m_command_buffer, &dependency_info);
+    }
+
+    void VulkanCommandList::begin_gpu_scope(const std::string_view name)
+    {
+        const auto depth = static_cast<uint32_t>(m_gpu_scopes.size());
+        m_gpu_scopes.push_back(m_graphics_device.gpu_profiler().begin_scope(m_command_buffer, m_queue_type, name, depth));
+    }
+
+    void VulkanCommandList::end_gpu_scope()
+    {
+        HE_ASSERT(!m_gpu_scopes.empty());
+
+        m_graphics_device.gpu_profiler().end_scope(m_command_buffer, m_gpu_scopes.back());
+        m_gpu_scopes.pop_back();
+    }
+
+    void VulkanCommandList::begin_render_pass(const RenderPassDescriptor &descriptor)
+    {
+        const std::shared_ptr<VulkanTexture> color_attachment = std::dynamic_pointer_cast<VulkanTexture>(descriptor.color_attachment);
+        HE_ASSERT(color_attachment, "Render pass '{}' has no color attachment", descriptor.label);
+
+        const VkRenderingAttachmentInfo color_attachment_info = {
+            .sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO,
+            .pNext = nullptr,
+            .imageView = color_attachment->image_view(),
+            .imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            .resolveMode = VK_RESOLVE_MODE_NONE,
+            .resolveImageView = VK_NULL_HANDLE,
+            .resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+            .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+            .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+            .clearValue =
+                {
+                    .color =
+                        {
+                            .float32 =
+                                {
+                                    descriptor.clear_color[0],
+                                    descriptor.clear_color[1],
+                                    descriptor.clear_color[2],
+                                    descriptor.clear_color[3],
+                                },
+                        },
+                },
+        };
+
+        const VkExtent2D extent = {
+            .width = descriptor.color_attachment->width(),
+            .height = descriptor.color_attachment->height(),
+        };
+
+        const VkRenderingInfo rendering_info = {
+            .sType = VK_STRUCTURE_TYPE_RENDERING_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .renderArea =
+                {
+                    .offset = { 0, 0 },
+                    .extent = extent,
+                },
+            .layerCount = 1,
+            .viewMask = 0,
+            .colorAttachmentCount = 1,
+            .pColorAttachments = &color_attachment_info,
+            .pDepthAttachment = nullptr,
+            .pStencilAttachment = nullptr,
+        };
+        vkCmdBeginRendering(m_command_buffer, &rendering_info);
+
+        const VkViewport viewport = {
+            .x = 0.0f,
+            .y = 0.0f,
+            .width = static_cast<float>(extent.width),
+            .height = static_cast<float>(extent.height),
+            .minDepth = 0.0f,
+            .maxDepth = 1.0f,
+        };
+        vkCmdSetViewport(m_command_buffer, 0, 1, &viewport);
+
+        const VkRect2D scissor = {
+            .offset = { 0, 0 },
+            .extent = extent,
+        };
+        vkCmdSetScissor(m_command_buffer, 0, 1, &scissor);
+    }
+
+    void VulkanCommandList::end_render_pass()
+    {
+        vkCmdEndRendering(m_command_buffer);
+    }
+
+    void VulkanCommandList::set_pipeline(const GraphicsPipelineHandle &pipeline)
+    {
+        const std::shared_ptr<VulkanGraphicsPipeline> graphics_pipeline = std::dynamic_pointer_cast<VulkanGraphicsPipeline>(pipeline);
+        HE_ASSERT(graphics_pipeline);
+
+        vkCmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphics_pipeline->pipeline());
+
+        m_pipeline_layout = graphics_pipeline->pipeline_layout();
     }
 
-    void VulkanCommandList::end() const
+    void VulkanCommandList::set_index_buffer(const BufferHandle &buffer)
     {
-        const VkCommandBuffer &command_buffer = m_graphics_device.current_frame().command_buffer;
+        const std::shared_ptr<VulkanBuffer> index_buffer = std::dynamic_pointer_cast<VulkanBuffer>(buffer);
+        HE_ASSERT(index_buffer);
+
+        vkCmdBindIndexBuffer(m_command_buffer, index_buffer->buffer(), 0, VK_INDEX_TYPE_UINT32);
+    }
+
+    void VulkanCommandList::set_push_constants(const void *data, const size_t byte_size)
+    {
+        HE_ASSERT(m_pipeline_layout != VK_NULL_HANDLE, "Push constants have to be set after a pipeline");
+        HE_ASSERT(byte_size <= VulkanDescriptorManager::s_push_constant_size);
+
+        vkCmdPushConstants(m_command_buffer, m_pipeline_layout, VK_SHADER_STAGE_ALL, 0, static_cast<uint32_t>(byte_size), data);
+    }
+
+    void VulkanCommandList::draw_indexed_indirect(const BufferHandle &argument_buffer, const uint64_t argument_offset, const uint32_t draw_count)
+    {
+        const std::shared_ptr<VulkanBuffer> buffer = std::dynamic_pointer_cast<VulkanBuffer>(argument_buffer);
+        HE_ASSERT(buffer);
+
+        vkCmdDrawIndexedIndirect(m_command_buffer, buffer->buffer(), argument_offset, draw_count, sizeof(DrawIndexedIndirectArguments));
+    }
+
+    void VulkanCommandList::draw_indexed_indirect_count(
+        const BufferHandle &argument_buffer,
+        const uint64_t argument_offset,
+        const BufferHandle &count_buffer,
+        const uint64_t count_offset,
+        const uint32_t max_draw_count)
+    {
+        const std::shared_ptr<VulkanBuffer> buffer = std::dynamic_pointer_cast<VulkanBuffer>(argument_buffer);
+        HE_ASSERT(buffer);
+
+        const std::shared_ptr<VulkanBuffer> draw_count_buffer = std::dynamic_pointer_cast<VulkanBuffer>(count_buffer);
+        HE_ASSERT(draw_count_buffer);
 
-        vkEndCommandBuffer(command_buffer);
+        vkCmdDrawIndexedIndirectCount(
+            m_command_buffer,
+            buffer->buffer(),
+            argument_offset,
+            draw_count_buffer->buffer(),
+            count_offset,
+            max_draw_count,
+            sizeof(DrawIndexedIndirectArguments));
     }
 } // namespace hyper_rhi
\ No newline at end of file
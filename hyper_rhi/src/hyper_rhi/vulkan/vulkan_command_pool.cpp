@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_command_pool.hpp"
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    VulkanCommandPool::VulkanCommandPool(VulkanGraphicsDevice &graphics_device, const uint32_t queue_family_index)
+        : m_graphics_device(graphics_device)
+        , m_command_pool(VK_NULL_HANDLE)
+        , m_command_buffers()
+        , m_used_command_buffers(0)
+    {
+        const VkCommandPoolCreateInfo command_pool_create_info = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+            .queueFamilyIndex = queue_family_index,
+        };
+
+        HE_VK_CHECK(vkCreateCommandPool(m_graphics_device.device(), &command_pool_create_info, nullptr, &m_command_pool));
+        HE_ASSERT(m_command_pool != VK_NULL_HANDLE);
+    }
+
+    VulkanCommandPool::~VulkanCommandPool()
+    {
+        vkDestroyCommandPool(m_graphics_device.device(), m_command_pool, nullptr);
+    }
+
+    VkCommandBuffer VulkanCommandPool::acquire()
+    {
+        if (m_used_command_buffers < m_command_buffers.size())
+        {
+            return m_command_buffers[m_used_command_buffers++];
+        }
+
+        const VkCommandBufferAllocateInfo command_buffer_allocate_info = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            .pNext = nullptr,
+            .commandPool = m_command_pool,
+            .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            .commandBufferCount = 1,
+        };
+
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        HE_VK_CHECK(vkAllocateCommandBuffers(m_graphics_device.device(), &command_buffer_allocate_info, &command_buffer));
+        HE_ASSERT(command_buffer != VK_NULL_HANDLE);
+
+        m_command_buffers.push_back(command_buffer);
+        ++m_used_command_buffers;
+
+        return command_buffer;
+    }
+
+    void VulkanCommandPool::reset()
+    {
+        if (m_used_command_buffers == 0)
+        {
+            return;
+        }
+
+        // NOTE: Resetting the whole pool recycles every buffer at once, the buffers themselves are kept for reuse
+        HE_VK_CHECK(vkResetCommandPool(m_graphics_device.device(), m_command_pool, 0));
+        m_used_command_buffers = 0;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_compute_pipeline.hpp"
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_pipeline_cache.hpp"
+#include "hyper_rhi/vulkan/vulkan_pipeline_layout.hpp"
+#include "hyper_rhi/vulkan/vulkan_shader_module.hpp"
+
+namespace hyper_rhi
+{
+    VulkanComputePipeline::VulkanComputePipeline(VulkanGraphicsDevice &graphics_device, const ComputePipelineDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_layout(std::dynamic_pointer_cast<VulkanPipelineLayout>(descriptor.layout))
+        , m_pipeline(VK_NULL_HANDLE)
+    {
+        HE_ASSERT(m_layout != nullptr);
+        HE_ASSERT(descriptor.shader != nullptr);
+
+        const std::shared_ptr<VulkanShaderModule> shader = std::dynamic_pointer_cast<VulkanShaderModule>(descriptor.shader);
+
+        const VkComputePipelineCreateInfo compute_pipeline_create_info = {
+            .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = m_graphics_device.descriptor_manager().pipeline_create_flags(),
+            .stage = shader->shader_stage_create_info(),
+            .layout = m_layout->pipeline_layout(),
+            .basePipelineHandle = VK_NULL_HANDLE,
+            .basePipelineIndex = -1,
+        };
+
+        HE_VK_CHECK(vkCreateComputePipelines(
+            m_graphics_device.device(), m_graphics_device.pipeline_cache().pipeline_cache(), 1, &compute_pipeline_create_info, nullptr, &m_pipeline));
+        HE_ASSERT(m_pipeline != VK_NULL_HANDLE);
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_PIPELINE, reinterpret_cast<uint64_t>(m_pipeline), descriptor.label);
+
+        HE_TRACE("Created Compute Pipeline '{}'", descriptor.label);
+    }
+
+    VulkanComputePipeline::~VulkanComputePipeline()
+    {
+        m_graphics_device.deletion_queue().enqueue(
+            [device = m_graphics_device.device(), pipeline = m_pipeline]()
+            {
+                vkDestroyPipeline(device, pipeline, nullptr);
+            });
+    }
+
+    VkPipelineLayout VulkanComputePipeline::pipeline_layout() const
+    {
+        return m_layout->pipeline_layout();
+    }
+
+    VkPipeline VulkanComputePipeline::pipeline() const
+    {
+        return m_pipeline;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_deletion_queue.hpp"
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    VulkanDeletionQueue::VulkanDeletionQueue(VulkanGraphicsDevice &graphics_device)
+        : m_graphics_device(graphics_device)
+        , m_deletions()
+        , m_pending_deletions()
+    {
+    }
+
+    VulkanDeletionQueue::~VulkanDeletionQueue()
+    {
+        this->flush_all();
+    }
+
+    void VulkanDeletionQueue::enqueue(std::function<void()> deleter)
+    {
+        m_deletions.push({
+            .timeline_value = m_graphics_device.retire_timeline_value(),
+            .deleter = std::move(deleter),
+        });
+    }
+
+    void VulkanDeletionQueue::flush(const uint64_t completed_timeline_value)
+    {
+        this->collect();
+
+        size_t deletion_count = 0;
+        std::erase_if(
+            m_pending_deletions,
+            [completed_timeline_value, &deletion_count](const Deletion &deletion)
+            {
+                if (deletion.timeline_value > completed_timeline_value)
+                {
+                    return false;
+                }
+
+                deletion.deleter();
+                ++deletion_count;
+                return true;
+            });
+
+        if (deletion_count > 0)
+        {
+            HE_TRACE("Destroyed {} deferred resources", deletion_count);
+        }
+    }
+
+    void VulkanDeletionQueue::flush_all()
+    {
+        this->collect();
+
+        for (const Deletion &deletion : m_pending_deletions)
+        {
+            deletion.deleter();
+        }
+
+        m_pending_deletions.clear();
+    }
+
+    void VulkanDeletionQueue::collect()
+    {
+        while (std::optional<Deletion> deletion = m_deletions.pop())
+        {
+            m_pending_deletions.push_back(std::move(deletion.value()));
+        }
+    }
+} // namespace hyper_rhi
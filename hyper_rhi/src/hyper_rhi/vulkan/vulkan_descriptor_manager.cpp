@@ -6,39 +6,365 @@
 
 #include "hyper_rhi/vulkan/vulkan_descriptor_manager.hpp"
 
+#include <algorithm>
+#include <span>
+
 #include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
 
 namespace hyper_rhi
 {
     VulkanDescriptorManager::VulkanDescriptorManager(VulkanGraphicsDevice &graphics_device)
         : m_graphics_device(graphics_device)
+        , m_descriptor_buffer_enabled(graphics_device.descriptor_buffer_supported())
+        , m_descriptor_buffer_properties({})
         , m_descriptor_counts({})
-        , m_descriptor_pool(nullptr)
+        , m_descriptor_sizes({})
         , m_descriptor_set_layouts()
+        , m_pipeline_layout(VK_NULL_HANDLE)
+        , m_descriptor_pool(VK_NULL_HANDLE)
         , m_descriptor_sets()
-        , m_recycled_descriptors()
-        , m_current_index(0)
+        , m_descriptor_buffer(VK_NULL_HANDLE)
+        , m_descriptor_buffer_allocation(VK_NULL_HANDLE)
+        , m_descriptor_buffer_data(nullptr)
+        , m_descriptor_buffer_address(0)
+        , m_descriptor_set_offsets({})
+        , m_descriptor_binding_offsets({})
+        , m_index_allocators()
+        , m_retired_handles()
+        , m_pending_retired_handles()
+        , m_pending_writes()
+        , m_flushed_writes()
+        , m_buffer_infos()
+        , m_image_infos()
+        , m_write_descriptor_sets()
     {
         this->find_descriptor_counts();
-        this->create_descriptor_pool();
         this->create_descriptor_set_layouts();
-        this->create_descriptor_sets();
+        this->create_pipeline_layout();
+
+        if (m_descriptor_buffer_enabled)
+        {
+            this->create_descriptor_buffer();
+        }
+        else
+        {
+            this->create_descriptor_pool();
+            this->create_descriptor_sets();
+        }
+
+        for (size_t index = 0; index != s_descriptor_types.size(); ++index)
+        {
+            m_index_allocators[index] = std::make_unique<DescriptorIndexAllocator>(m_descriptor_counts[index]);
+        }
     }
 
     VulkanDescriptorManager::~VulkanDescriptorManager()
     {
+        if (m_descriptor_buffer != VK_NULL_HANDLE)
+        {
+            vmaDestroyBuffer(m_graphics_device.allocator(), m_descriptor_buffer, m_descriptor_buffer_allocation);
+        }
+
+        vkDestroyDescriptorPool(m_graphics_device.device(), m_descriptor_pool, nullptr);
+        vkDestroyPipelineLayout(m_graphics_device.device(), m_pipeline_layout, nullptr);
+
         for (const VkDescriptorSetLayout &descriptor_set_layout : m_descriptor_set_layouts)
         {
             vkDestroyDescriptorSetLayout(m_graphics_device.device(), descriptor_set_layout, nullptr);
         }
+    }
 
-        vkDestroyDescriptorPool(m_graphics_device.device(), m_descriptor_pool, nullptr);
+    const std::array<VkDescriptorSetLayout, VulkanDescriptorManager::s_descriptor_types.size()> &VulkanDescriptorManager::
+        descriptor_set_layouts() const
+    {
+        return m_descriptor_set_layouts;
+    }
+
+    VkPipelineCreateFlags VulkanDescriptorManager::pipeline_create_flags() const
+    {
+        return m_descriptor_buffer_enabled ? VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
+    }
+
+    ResourceHandle VulkanDescriptorManager::allocate_buffer_handle(const VkBuffer buffer, const VkDeviceSize byte_size)
+    {
+        const uint32_t index = this->index_allocator(DescriptorHeapType::StorageBuffer).allocate();
+
+        if (m_descriptor_buffer_enabled)
+        {
+            const VkBufferDeviceAddressInfo buffer_device_address_info = {
+                .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+                .pNext = nullptr,
+                .buffer = buffer,
+            };
+
+            const VkDescriptorAddressInfoEXT descriptor_address_info = {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT,
+                .pNext = nullptr,
+                .address = vkGetBufferDeviceAddress(m_graphics_device.device(), &buffer_device_address_info),
+                .range = byte_size,
+                .format = VK_FORMAT_UNDEFINED,
+            };
+
+            this->write_descriptor(
+                DescriptorHeapType::StorageBuffer,
+                index,
+                {
+                    .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                    .pNext = nullptr,
+                    .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                    .data = { .pStorageBuffer = &descriptor_address_info },
+                });
+
+            return ResourceHandle(index);
+        }
+
+        m_pending_writes.push({
+            .heap_type = DescriptorHeapType::StorageBuffer,
+            .index = index,
+            .buffer_info =
+                VkDescriptorBufferInfo{
+                    .buffer = buffer,
+                    .offset = 0,
+                    .range = VK_WHOLE_SIZE,
+                },
+            .image_info = {},
+        });
+
+        return ResourceHandle(index);
+    }
+
+    ResourceHandle VulkanDescriptorManager::allocate_image_handle(const DescriptorHeapType heap_type, const VkImageView image_view)
+    {
+        HE_ASSERT(heap_type == DescriptorHeapType::SampledImage || heap_type == DescriptorHeapType::StorageImage);
+
+        const uint32_t index = this->index_allocator(heap_type).allocate();
+
+        // NOTE: Sampled images are read in SHADER_READ_ONLY_OPTIMAL, storage images are always accessed in GENERAL
+        const VkDescriptorImageInfo image_info = {
+            .sampler = VK_NULL_HANDLE,
+            .imageView = image_view,
+            .imageLayout = heap_type == DescriptorHeapType::SampledImage ? VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL,
+        };
+
+        if (m_descriptor_buffer_enabled)
+        {
+            VkDescriptorGetInfoEXT descriptor_get_info = {
+                .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT,
+                .pNext = nullptr,
+                .type = s_descriptor_types[static_cast<size_t>(heap_type)],
+                .data = {},
+            };
+
+            if (heap_type == DescriptorHeapType::SampledImage)
+            {
+                descriptor_get_info.data.pSampledImage = &image_info;
+            }
+            else
+            {
+                descriptor_get_info.data.pStorageImage = &image_info;
+            }
+
+            this->write_descriptor(heap_type, index, descriptor_get_info);
+            return ResourceHandle(index);
+        }
+
+        m_pending_writes.push({
+            .heap_type = heap_type,
+            .index = index,
+            .buffer_info = {},
+            .image_info = image_info,
+        });
+
+        return ResourceHandle(index);
+    }
+
+    void VulkanDescriptorManager::retire_handle(const DescriptorHeapType heap_type, const ResourceHandle &handle)
+    {
+        m_retired_handles.push({
+            .heap_type = heap_type,
+            .index = handle.handle(),
+            .timeline_value = m_graphics_device.retire_timeline_value(),
+        });
+    }
+
+    void VulkanDescriptorManager::recycle(const uint64_t completed_timeline_value)
+    {
+        while (std::optional<RetiredHandle> retired_handle = m_retired_handles.pop())
+        {
+            m_pending_retired_handles.push_back(retired_handle.value());
+        }
+
+        std::erase_if(
+            m_pending_retired_handles,
+            [this, completed_timeline_value](const RetiredHandle &retired_handle)
+            {
+                if (retired_handle.timeline_value > completed_timeline_value)
+                {
+                    return false;
+                }
+
+                this->index_allocator(retired_handle.heap_type).free(retired_handle.index);
+                return true;
+            });
+    }
+
+    void VulkanDescriptorManager::flush_writes()
+    {
+        m_flushed_writes.clear();
+        while (std::optional<PendingWrite> pending_write = m_pending_writes.pop())
+        {
+            m_flushed_writes.push_back(pending_write.value());
+        }
+
+        if (m_flushed_writes.empty())
+        {
+            return;
+        }
+
+        std::stable_sort(
+            m_flushed_writes.begin(),
+            m_flushed_writes.end(),
+            [](const PendingWrite &left, const PendingWrite &right)
+            {
+                if (left.heap_type != right.heap_type)
+                {
+                    return left.heap_type < right.heap_type;
+                }
+
+                return left.index < right.index;
+            });
+
+        // NOTE: The info arrays are sized upfront, so pointers into them stay valid while the writes are built
+        m_buffer_infos.clear();
+        m_buffer_infos.reserve(m_flushed_writes.size());
+        m_image_infos.clear();
+        m_image_infos.reserve(m_flushed_writes.size());
+        m_write_descriptor_sets.clear();
+
+        for (size_t index = 0; index < m_flushed_writes.size(); ++index)
+        {
+            const PendingWrite &pending_write = m_flushed_writes[index];
+
+            // NOTE: Only the latest write to a descriptor is kept
+            if (index + 1 < m_flushed_writes.size() && m_flushed_writes[index + 1].heap_type == pending_write.heap_type &&
+                m_flushed_writes[index + 1].index == pending_write.index)
+            {
+                continue;
+            }
+
+            const size_t heap_index = static_cast<size_t>(pending_write.heap_type);
+            const VkDescriptorType descriptor_type = s_descriptor_types[heap_index];
+            const bool is_buffer = descriptor_type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+
+            if (is_buffer)
+            {
+                m_buffer_infos.push_back(pending_write.buffer_info);
+            }
+            else
+            {
+                m_image_infos.push_back(pending_write.image_info);
+            }
+
+            if (!m_write_descriptor_sets.empty())
+            {
+                VkWriteDescriptorSet &previous_write = m_write_descriptor_sets.back();
+                if (previous_write.dstSet == m_descriptor_sets[heap_index] &&
+                    previous_write.dstArrayElement + previous_write.descriptorCount == pending_write.index)
+                {
+                    ++previous_write.descriptorCount;
+                    continue;
+                }
+            }
+
+            m_write_descriptor_sets.push_back({
+                .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                .pNext = nullptr,
+                .dstSet = m_descriptor_sets[heap_index],
+                .dstBinding = 0,
+                .dstArrayElement = pending_write.index,
+                .descriptorCount = 1,
+                .descriptorType = descriptor_type,
+                .pImageInfo = is_buffer ? nullptr : &m_image_infos.back(),
+                .pBufferInfo = is_buffer ? &m_buffer_infos.back() : nullptr,
+                .pTexelBufferView = nullptr,
+            });
+        }
+
+        vkUpdateDescriptorSets(
+            m_graphics_device.device(), static_cast<uint32_t>(m_write_descriptor_sets.size()), m_write_descriptor_sets.data(), 0, nullptr);
+    }
+
+    void VulkanDescriptorManager::bind(const VkCommandBuffer command_buffer, const QueueType queue_type) const
+    {
+        if (queue_type == QueueType::Transfer)
+        {
+            return;
+        }
+
+        // NOTE: Graphics command lists may also dispatch, so they get the bindless sets on both bind points
+        constexpr std::array<VkPipelineBindPoint, 2> bind_points = {
+            VK_PIPELINE_BIND_POINT_COMPUTE,
+            VK_PIPELINE_BIND_POINT_GRAPHICS,
+        };
+        const std::span<const VkPipelineBindPoint> queue_bind_points =
+            std::span(bind_points).first(queue_type == QueueType::Graphics ? bind_points.size() : 1);
+
+        if (!m_descriptor_buffer_enabled)
+        {
+            for (const VkPipelineBindPoint bind_point : queue_bind_points)
+            {
+                vkCmdBindDescriptorSets(
+                    command_buffer,
+                    bind_point,
+                    m_pipeline_layout,
+                    0,
+                    static_cast<uint32_t>(m_descriptor_sets.size()),
+                    m_descriptor_sets.data(),
+                    0,
+                    nullptr);
+            }
+
+            return;
+        }
+
+        const VkDescriptorBufferBindingInfoEXT descriptor_buffer_binding_info = {
+            .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT,
+            .pNext = nullptr,
+            .address = m_descriptor_buffer_address,
+            .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT,
+        };
+
+        vkCmdBindDescriptorBuffersEXT(command_buffer, 1, &descriptor_buffer_binding_info);
+
+        constexpr std::array<uint32_t, s_descriptor_types.size()> buffer_indices = {};
+        for (const VkPipelineBindPoint bind_point : queue_bind_points)
+        {
+            vkCmdSetDescriptorBufferOffsetsEXT(
+                command_buffer,
+                bind_point,
+                m_pipeline_layout,
+                0,
+                static_cast<uint32_t>(buffer_indices.size()),
+                buffer_indices.data(),
+                m_descriptor_set_offsets.data());
+        }
     }
 
     void VulkanDescriptorManager::find_descriptor_counts()
     {
-        VkPhysicalDeviceProperties properties = {};
-        vkGetPhysicalDeviceProperties(m_graphics_device.physical_device(), &properties);
+        m_descriptor_buffer_properties = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT,
+            .pNext = nullptr,
+        };
+
+        VkPhysicalDeviceProperties2 properties2 = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+            .pNext = m_descriptor_buffer_enabled ? &m_descriptor_buffer_properties : nullptr,
+            .properties = {},
+        };
+        vkGetPhysicalDeviceProperties2(m_graphics_device.physical_device(), &properties2);
+
+        const VkPhysicalDeviceProperties &properties = properties2.properties;
 
         for (size_t index = 0; index != s_descriptor_types.size(); ++index)
         {
@@ -59,7 +385,32 @@ namespace hyper_rhi
                 }
             }();
 
-            const uint32_t descriptor_count = limit > GraphicsDevice::s_descriptor_limit ? GraphicsDevice::s_descriptor_limit : limit;
+            uint32_t descriptor_count = limit > GraphicsDevice::s_descriptor_limit ? GraphicsDevice::s_descriptor_limit : limit;
+
+            if (m_descriptor_buffer_enabled)
+            {
+                const size_t descriptor_size = [this, &descriptor_type]()
+                {
+                    switch (descriptor_type)
+                    {
+                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                        return m_descriptor_buffer_properties.storageBufferDescriptorSize;
+                    case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                        return m_descriptor_buffer_properties.sampledImageDescriptorSize;
+                    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                        return m_descriptor_buffer_properties.storageImageDescriptorSize;
+                    default:
+                        HE_UNREACHABLE();
+                    }
+                }();
+
+                // NOTE: All heaps live in one descriptor buffer, which has to fit into the addressable resource descriptor range
+                const VkDeviceSize range_limit =
+                    m_descriptor_buffer_properties.maxResourceDescriptorBufferRange / (s_descriptor_types.size() * descriptor_size);
+                descriptor_count = static_cast<uint32_t>(std::min<VkDeviceSize>(descriptor_count, range_limit));
+
+                m_descriptor_sizes[index] = descriptor_size;
+            }
 
             m_descriptor_counts[index] = descriptor_count;
         }
@@ -109,9 +460,11 @@ namespace hyper_rhi
                 .pImmutableSamplers = nullptr,
             };
 
-            constexpr VkDescriptorBindingFlags descriptor_binding_flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
-                                                                          VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT |
-                                                                          VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+            // NOTE: Descriptor buffers are written directly and never go through a pool, so they need no update-after-bind flags
+            const VkDescriptorBindingFlags descriptor_binding_flags =
+                m_descriptor_buffer_enabled ? VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT
+                                            : VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT |
+                                                  VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
 
             VkDescriptorSetLayoutBindingFlagsCreateInfo descriptor_set_layout_binding_flags_info = {
                 .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
@@ -123,7 +476,8 @@ namespace hyper_rhi
             const VkDescriptorSetLayoutCreateInfo descriptor_set_layout_create_info = {
                 .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
                 .pNext = &descriptor_set_layout_binding_flags_info,
-                .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+                .flags = m_descriptor_buffer_enabled ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT
+                                                     : VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
                 .bindingCount = 1,
                 .pBindings = &descriptor_set_layout_binding
             };
@@ -160,4 +514,113 @@ namespace hyper_rhi
             HE_ASSERT(m_descriptor_sets[index] != VK_NULL_HANDLE);
         }
     }
+
+    void VulkanDescriptorManager::create_descriptor_buffer()
+    {
+        const VkDeviceSize offset_alignment = m_descriptor_buffer_properties.descriptorBufferOffsetAlignment;
+
+        VkDeviceSize byte_size = 0;
+        for (size_t index = 0; index != m_descriptor_set_layouts.size(); ++index)
+        {
+            VkDeviceSize layout_size = 0;
+            vkGetDescriptorSetLayoutSizeEXT(m_graphics_device.device(), m_descriptor_set_layouts[index], &layout_size);
+
+            VkDeviceSize binding_offset = 0;
+            vkGetDescriptorSetLayoutBindingOffsetEXT(m_graphics_device.device(), m_descriptor_set_layouts[index], 0, &binding_offset);
+
+            byte_size = (byte_size + offset_alignment - 1) / offset_alignment * offset_alignment;
+
+            m_descriptor_set_offsets[index] = byte_size;
+            m_descriptor_binding_offsets[index] = byte_size + binding_offset;
+
+            byte_size += layout_size;
+        }
+
+        const VkBufferCreateInfo buffer_create_info = {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = byte_size,
+            .usage = VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        };
+
+        // NOTE: Descriptors are written from the CPU without flushes, so the memory has to be coherent
+        const VmaAllocationCreateInfo allocation_create_info = {
+            .flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+            .usage = VMA_MEMORY_USAGE_AUTO,
+            .requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            .preferredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
+            .priority = 1.0f,
+        };
+
+        VmaAllocationInfo allocation_info = {};
+        HE_VK_CHECK(vmaCreateBuffer(
+            m_graphics_device.allocator(),
+            &buffer_create_info,
+            &allocation_create_info,
+            &m_descriptor_buffer,
+            &m_descriptor_buffer_allocation,
+            &allocation_info));
+        HE_ASSERT(m_descriptor_buffer != VK_NULL_HANDLE);
+        HE_ASSERT(allocation_info.pMappedData != nullptr);
+
+        m_descriptor_buffer_data = static_cast<uint8_t *>(allocation_info.pMappedData);
+
+        const VkBufferDeviceAddressInfo buffer_device_address_info = {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+            .pNext = nullptr,
+            .buffer = m_descriptor_buffer,
+        };
+        m_descriptor_buffer_address = vkGetBufferDeviceAddress(m_graphics_device.device(), &buffer_device_address_info);
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<uint64_t>(m_descriptor_buffer), "Descriptor Buffer");
+
+        HE_DEBUG("Created Descriptor Buffer with {} bytes", byte_size);
+    }
+
+    void VulkanDescriptorManager::create_pipeline_layout()
+    {
+        constexpr VkPushConstantRange push_constant_range = {
+            .stageFlags = VK_SHADER_STAGE_ALL,
+            .offset = 0,
+            .size = s_push_constant_size,
+        };
+
+        const VkPipelineLayoutCreateInfo pipeline_layout_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .setLayoutCount = static_cast<uint32_t>(m_descriptor_set_layouts.size()),
+            .pSetLayouts = m_descriptor_set_layouts.data(),
+            .pushConstantRangeCount = 1,
+            .pPushConstantRanges = &push_constant_range,
+        };
+
+        HE_VK_CHECK(vkCreatePipelineLayout(m_graphics_device.device(), &pipeline_layout_create_info, nullptr, &m_pipeline_layout));
+        HE_ASSERT(m_pipeline_layout != VK_NULL_HANDLE);
+    }
+
+    void VulkanDescriptorManager::write_descriptor(
+        const DescriptorHeapType heap_type,
+        const uint32_t index,
+        const VkDescriptorGetInfoEXT &descriptor_get_info) const
+    {
+        const size_t heap_index = static_cast<size_t>(heap_type);
+        const size_t descriptor_size = m_descriptor_sizes[heap_index];
+
+        // NOTE: Array elements are tightly packed behind the binding offset
+        uint8_t *descriptor = m_descriptor_buffer_data + m_descriptor_binding_offsets[heap_index] + index * descriptor_size;
+        vkGetDescriptorEXT(m_graphics_device.device(), &descriptor_get_info, descriptor_size, descriptor);
+    }
+
+    DescriptorIndexAllocator &VulkanDescriptorManager::index_allocator(const DescriptorHeapType heap_type) const
+    {
+        return *m_index_allocators[static_cast<size_t>(heap_type)];
+    }
 } // namespace hyper_rhi
\ No newline at end of file
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_gpu_profiler.hpp"
+
+#include <algorithm>
+#include <optional>
+
+#include <fmt/format.h>
+
+#include <hyper_core/profiler.hpp>
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    struct PipelineStatistic
+    {
+        VkQueryPipelineStatisticFlagBits flag;
+        std::string_view name;
+    };
+
+    // NOTE: Results are written in the order of the flag bits, so this list has to stay sorted
+    static constexpr std::array<PipelineStatistic, 6> g_pipeline_statistics = {
+        PipelineStatistic{ VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT, "Input Vertices" },
+        PipelineStatistic{ VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT, "Input Primitives" },
+        PipelineStatistic{ VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT, "Vertex Shader Invocations" },
+        PipelineStatistic{ VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT, "Clipping Primitives" },
+        PipelineStatistic{ VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT, "Fragment Shader Invocations" },
+        PipelineStatistic{ VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT, "Compute Shader Invocations" },
+    };
+
+    VulkanGpuProfiler::VulkanGpuProfiler(
+        VulkanGraphicsDevice &graphics_device,
+        const bool pipeline_statistics_supported,
+        const float timestamp_period)
+        : m_graphics_device(graphics_device)
+        , m_pipeline_statistics_supported(pipeline_statistics_supported)
+        , m_timestamp_period(timestamp_period)
+        , m_timestamps_supported({})
+        , m_frames({})
+        , m_current_frame_slot(0)
+        , m_mutex()
+    {
+        uint32_t queue_family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(m_graphics_device.physical_device(), &queue_family_count, nullptr);
+
+        std::vector<VkQueueFamilyProperties> queue_family_properties(queue_family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(m_graphics_device.physical_device(), &queue_family_count, queue_family_properties.data());
+
+        for (size_t queue_type = 0; queue_type < GraphicsDevice::s_queue_type_count; ++queue_type)
+        {
+            const uint32_t family_index = m_graphics_device.queue(static_cast<QueueType>(queue_type)).family_index;
+            m_timestamps_supported[queue_type] = queue_family_properties[family_index].timestampValidBits != 0;
+        }
+
+        VkQueryPipelineStatisticFlags pipeline_statistics = 0;
+        for (const PipelineStatistic &pipeline_statistic : g_pipeline_statistics)
+        {
+            pipeline_statistics |= pipeline_statistic.flag;
+        }
+
+        for (size_t frame_slot = 0; frame_slot < m_frames.size(); ++frame_slot)
+        {
+            FrameQueries &frame = m_frames[frame_slot];
+
+            const VkQueryPoolCreateInfo timestamp_query_pool_create_info = {
+                .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                .pNext = nullptr,
+                .flags = 0,
+                .queryType = VK_QUERY_TYPE_TIMESTAMP,
+                .queryCount = s_max_scope_count * 2,
+                .pipelineStatistics = 0,
+            };
+            HE_VK_CHECK(vkCreateQueryPool(m_graphics_device.device(), &timestamp_query_pool_create_info, nullptr, &frame.timestamp_query_pool));
+            HE_ASSERT(frame.timestamp_query_pool != VK_NULL_HANDLE);
+
+            vkResetQueryPool(m_graphics_device.device(), frame.timestamp_query_pool, 0, s_max_scope_count * 2);
+
+            m_graphics_device.set_object_name(
+                VK_OBJECT_TYPE_QUERY_POOL,
+                reinterpret_cast<uint64_t>(frame.timestamp_query_pool),
+                fmt::format("Timestamp Query Pool #{}", frame_slot));
+
+            frame.statistics_query_pool = VK_NULL_HANDLE;
+            if (m_pipeline_statistics_supported)
+            {
+                const VkQueryPoolCreateInfo statistics_query_pool_create_info = {
+                    .sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+                    .pNext = nullptr,
+                    .flags = 0,
+                    .queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+                    .queryCount = s_max_scope_count,
+                    .pipelineStatistics = pipeline_statistics,
+                };
+                HE_VK_CHECK(
+                    vkCreateQueryPool(m_graphics_device.device(), &statistics_query_pool_create_info, nullptr, &frame.statistics_query_pool));
+                HE_ASSERT(frame.statistics_query_pool != VK_NULL_HANDLE);
+
+                vkResetQueryPool(m_graphics_device.device(), frame.statistics_query_pool, 0, s_max_scope_count);
+
+                m_graphics_device.set_object_name(
+                    VK_OBJECT_TYPE_QUERY_POOL,
+                    reinterpret_cast<uint64_t>(frame.statistics_query_pool),
+                    fmt::format("Pipeline Statistics Query Pool #{}", frame_slot));
+            }
+
+            frame.frame_index = 0;
+            frame.scopes.reserve(s_max_scope_count);
+            frame.statistics_query_count = 0;
+        }
+
+        HE_TRACE(
+            "Created GPU Profiler with {} scopes per frame and pipeline statistics {}",
+            s_max_scope_count,
+            m_pipeline_statistics_supported ? "enabled" : "disabled");
+    }
+
+    VulkanGpuProfiler::~VulkanGpuProfiler()
+    {
+        for (const FrameQueries &frame : m_frames)
+        {
+            vkDestroyQueryPool(m_graphics_device.device(), frame.statistics_query_pool, nullptr);
+            vkDestroyQueryPool(m_graphics_device.device(), frame.timestamp_query_pool, nullptr);
+        }
+    }
+
+    void VulkanGpuProfiler::begin_frame(const uint64_t frame_index)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        m_current_frame_slot = static_cast<uint32_t>(frame_index % m_frames.size());
+
+        FrameQueries &frame = m_frames[m_current_frame_slot];
+        if (!frame.scopes.empty())
+        {
+            this->resolve(frame);
+
+            vkResetQueryPool(m_graphics_device.device(), frame.timestamp_query_pool, 0, static_cast<uint32_t>(frame.scopes.size()) * 2);
+            if (frame.statistics_query_count != 0)
+            {
+                vkResetQueryPool(m_graphics_device.device(), frame.statistics_query_pool, 0, frame.statistics_query_count);
+            }
+        }
+
+        frame.frame_index = frame_index;
+        frame.scopes.clear();
+        frame.statistics_query_count = 0;
+    }
+
+    VulkanGpuProfiler::ScopeQueries VulkanGpuProfiler::begin_scope(
+        const VkCommandBuffer command_buffer,
+        const QueueType queue_type,
+        const std::string_view name,
+        const uint32_t depth)
+    {
+        if (!hyper_core::Profiler::enabled() || !m_timestamps_supported[static_cast<size_t>(queue_type)])
+        {
+            return {};
+        }
+
+        const std::lock_guard lock(m_mutex);
+
+        FrameQueries &frame = m_frames[m_current_frame_slot];
+        if (frame.scopes.size() >= s_max_scope_count)
+        {
+            return {};
+        }
+
+        // NOTE: Statistics queries of one type can't be nested and are restricted to graphics queues, so only top-level scopes get them
+        uint32_t statistics_query = s_invalid_query;
+        if (m_pipeline_statistics_supported && depth == 0 && queue_type == QueueType::Graphics)
+        {
+            statistics_query = frame.statistics_query_count;
+            frame.statistics_query_count += 1;
+        }
+
+        const auto scope = static_cast<uint32_t>(frame.scopes.size());
+        frame.scopes.push_back({
+            .name = std::string(name),
+            .queue_type = queue_type,
+            .depth = depth,
+            .statistics_query = statistics_query,
+        });
+
+        vkCmdWriteTimestamp2(command_buffer, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, frame.timestamp_query_pool, scope * 2);
+
+        if (statistics_query != s_invalid_query)
+        {
+            vkCmdBeginQuery(command_buffer, frame.statistics_query_pool, statistics_query, 0);
+        }
+
+        return {
+            .frame_slot = m_current_frame_slot,
+            .scope = scope,
+            .statistics_query = statistics_query,
+        };
+    }
+
+    void VulkanGpuProfiler::end_scope(const VkCommandBuffer command_buffer, const ScopeQueries &scope_queries)
+    {
+        if (scope_queries.scope == s_invalid_query)
+        {
+            return;
+        }
+
+        const FrameQueries &frame = m_frames[scope_queries.frame_slot];
+
+        if (scope_queries.statistics_query != s_invalid_query)
+        {
+            vkCmdEndQuery(command_buffer, frame.statistics_query_pool, scope_queries.statistics_query);
+        }
+
+        vkCmdWriteTimestamp2(command_buffer, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, frame.timestamp_query_pool, scope_queries.scope * 2 + 1);
+    }
+
+    void VulkanGpuProfiler::resolve(FrameQueries &frame) const
+    {
+        const auto scope_count = static_cast<uint32_t>(frame.scopes.size());
+
+        // NOTE: Every query is followed by its availability, scopes that were never submitted stay unavailable
+        std::vector<uint64_t> timestamps(static_cast<size_t>(scope_count) * 2 * 2);
+        const VkResult timestamp_result = vkGetQueryPoolResults(
+            m_graphics_device.device(),
+            frame.timestamp_query_pool,
+            0,
+            scope_count * 2,
+            timestamps.size() * sizeof(uint64_t),
+            timestamps.data(),
+            sizeof(uint64_t) * 2,
+            VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+        HE_ASSERT(timestamp_result == VK_SUCCESS || timestamp_result == VK_NOT_READY);
+
+        constexpr size_t statistics_stride = g_pipeline_statistics.size() + 1;
+
+        std::vector<uint64_t> statistics(frame.statistics_query_count * statistics_stride);
+        if (frame.statistics_query_count != 0)
+        {
+            const VkResult statistics_result = vkGetQueryPoolResults(
+                m_graphics_device.device(),
+                frame.statistics_query_pool,
+                0,
+                frame.statistics_query_count,
+                statistics.size() * sizeof(uint64_t),
+                statistics.data(),
+                sizeof(uint64_t) * statistics_stride,
+                VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+            HE_ASSERT(statistics_result == VK_SUCCESS || statistics_result == VK_NOT_READY);
+        }
+
+        const auto timestamp = [&timestamps](const uint32_t query) -> std::optional<uint64_t>
+        {
+            if (timestamps[query * 2 + 1] == 0)
+            {
+                return std::nullopt;
+            }
+
+            return timestamps[query * 2];
+        };
+
+        // NOTE: GPU ticks can't be correlated with the CPU clock here, so the earliest scope marks the start of the frame
+        uint64_t frame_start = std::numeric_limits<uint64_t>::max();
+        for (uint32_t scope = 0; scope < scope_count; ++scope)
+        {
+            if (const std::optional<uint64_t> start = timestamp(scope * 2); start && timestamp(scope * 2 + 1))
+            {
+                frame_start = std::min(frame_start, *start);
+            }
+        }
+
+        const auto ticks_to_milliseconds = [this](const uint64_t ticks)
+        {
+            return static_cast<double>(ticks) * static_cast<double>(m_timestamp_period) / 1'000'000.0;
+        };
+
+        std::vector<hyper_core::ProfileScope> profile_scopes;
+        profile_scopes.reserve(scope_count);
+        for (uint32_t scope_index = 0; scope_index < scope_count; ++scope_index)
+        {
+            const std::optional<uint64_t> start = timestamp(scope_index * 2);
+            const std::optional<uint64_t> end = timestamp(scope_index * 2 + 1);
+            if (!start || !end)
+            {
+                continue;
+            }
+
+            const Scope &scope = frame.scopes[scope_index];
+
+            std::vector<hyper_core::ProfileCounter> counters;
+            if (scope.statistics_query != s_invalid_query)
+            {
+                const uint64_t *values = statistics.data() + scope.statistics_query * statistics_stride;
+                if (values[g_pipeline_statistics.size()] != 0)
+                {
+                    for (size_t statistic = 0; statistic < g_pipeline_statistics.size(); ++statistic)
+                    {
+                        counters.push_back({
+                            .name = std::string(g_pipeline_statistics[statistic].name),
+                            .value = values[statistic],
+                        });
+                    }
+                }
+            }
+
+            const std::string_view track = [&scope]()
+            {
+                switch (scope.queue_type)
+                {
+                case QueueType::Graphics:
+                    return "GPU Graphics";
+                case QueueType::Compute:
+                    return "GPU Compute";
+                case QueueType::Transfer:
+                    return "GPU Transfer";
+                default:
+                    HE_UNREACHABLE();
+                }
+            }();
+
+            profile_scopes.push_back({
+                .name = scope.name,
+                .track = std::string(track),
+                .depth = scope.depth,
+                .start_milliseconds = ticks_to_milliseconds(*start - frame_start),
+                .duration_milliseconds = ticks_to_milliseconds(*end >= *start ? *end - *start : 0),
+                .counters = std::move(counters),
+            });
+        }
+
+        hyper_core::Profiler::submit_gpu_scopes(frame.frame_index, std::move(profile_scopes));
+    }
+} // namespace hyper_rhi
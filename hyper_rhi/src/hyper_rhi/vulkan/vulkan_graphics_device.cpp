@@ -6,7 +6,11 @@
 
 #include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cctype>
+#include <charconv>
+#include <chrono>
 #include <map>
 #include <set>
 #include <vector>
@@ -18,8 +22,16 @@
 
 #include <hyper_core/prerequisites.hpp>
 
+#include "hyper_rhi/vulkan/vulkan_buffer.hpp"
 #include "hyper_rhi/vulkan/vulkan_command_list.hpp"
+#include "hyper_rhi/vulkan/vulkan_compute_pipeline.hpp"
+#include "hyper_rhi/vulkan/vulkan_graphics_pipeline.hpp"
+#include "hyper_rhi/vulkan/vulkan_memory_heap.hpp"
+#include "hyper_rhi/vulkan/vulkan_pipeline_layout.hpp"
+#include "hyper_rhi/vulkan/vulkan_shader_module.hpp"
 #include "hyper_rhi/vulkan/vulkan_surface.hpp"
+#include "hyper_rhi/vulkan/vulkan_texture.hpp"
+#include "hyper_rhi/vulkan/vulkan_texture_view.hpp"
 
 namespace hyper_rhi
 {
@@ -31,19 +43,61 @@ namespace hyper_rhi
         VK_KHR_SWAPCHAIN_EXTENSION_NAME,
     };
 
+    static bool matches_adapter(const VulkanGraphicsDevice::PhysicalDeviceCapabilities &capabilities, const std::string_view adapter)
+    {
+        uint32_t index = 0;
+        const auto [end, error] = std::from_chars(adapter.data(), adapter.data() + adapter.size(), index);
+        if (error == std::errc() && end == adapter.data() + adapter.size())
+        {
+            return capabilities.index == index;
+        }
+
+        const auto match = std::search(
+            capabilities.name.begin(),
+            capabilities.name.end(),
+            adapter.begin(),
+            adapter.end(),
+            [](const char left, const char right)
+            {
+                return std::tolower(static_cast<unsigned char>(left)) == std::tolower(static_cast<unsigned char>(right));
+            });
+        return match != capabilities.name.end();
+    }
+
     VulkanGraphicsDevice::VulkanGraphicsDevice(const GraphicsDeviceDescriptor &descriptor)
         : m_validation_layers_enabled(false)
         , m_instance(VK_NULL_HANDLE)
         , m_debug_messenger(VK_NULL_HANDLE)
         , m_physical_device(VK_NULL_HANDLE)
+        , m_buffer_image_granularity(1)
+        , m_timestamp_period(1.0f)
+        , m_pipeline_statistics_supported(false)
+        , m_shader_int64_supported(false)
+        , m_memory_budget_supported(false)
+        , m_descriptor_buffer_supported(false)
+        , m_draw_indirect_count_supported(false)
         , m_device(VK_NULL_HANDLE)
-        , m_queue(VK_NULL_HANDLE)
+        , m_queues({})
+        , m_queue_family_indices()
         , m_allocator(VK_NULL_HANDLE)
+        , m_memory_budget()
+        , m_compute_pipelines()
+        , m_graphics_pipelines()
         , m_descriptor_manager(nullptr)
-        , m_submit_semaphore(VK_NULL_HANDLE)
+        , m_staging_ring(nullptr)
+        , m_deletion_queue(nullptr)
+        , m_pipeline_cache(nullptr)
+        , m_gpu_profiler(nullptr)
+        , m_thread_pool(descriptor.thread_pool)
         , m_frames({})
+        , m_command_pool_mutex()
+        , m_thread_command_pools()
+        , m_frame_count(descriptor.frame_count)
         , m_current_frame_index(0)
+        , m_executed_frame_index(0)
     {
+        HE_ASSERT(m_frame_count >= GraphicsDevice::s_min_frame_count && m_frame_count <= GraphicsDevice::s_max_frame_count);
+
         volkInitialize();
 
         if (descriptor.debug_mode)
@@ -61,11 +115,16 @@ namespace hyper_rhi
 
         this->create_instance();
         this->create_debug_messenger();
-        this->choose_physical_device();
+        this->choose_physical_device(descriptor.adapter);
         this->create_device();
         this->create_allocator();
+        this->create_timeline_semaphores();
 
         m_descriptor_manager = new VulkanDescriptorManager(*this);
+        m_staging_ring = new VulkanStagingRing(*this, descriptor.staging_ring_size);
+        m_deletion_queue = new VulkanDeletionQueue(*this);
+        m_pipeline_cache = new VulkanPipelineCache(*this, descriptor.pipeline_cache_path);
+        m_gpu_profiler = new VulkanGpuProfiler(*this, m_pipeline_statistics_supported, m_timestamp_period);
 
         this->create_frames();
 
@@ -74,17 +133,35 @@ namespace hyper_rhi
 
     VulkanGraphicsDevice::~VulkanGraphicsDevice()
     {
+        this->wait_for_idle();
+
+        m_memory_budget.log_statistics();
+        log_statistics("Compute pipeline", m_compute_pipelines.statistics());
+        log_statistics("Graphics pipeline", m_graphics_pipelines.statistics());
+
+        delete m_gpu_profiler;
+        delete m_deletion_queue;
+        delete m_pipeline_cache;
+
+        m_thread_command_pools.clear();
+
         for (const FrameData &frame : m_frames)
         {
             vkDestroySemaphore(m_device, frame.present_semaphore, nullptr);
             vkDestroySemaphore(m_device, frame.render_semaphore, nullptr);
-            vkDestroyCommandPool(m_device, frame.command_pool, nullptr);
+            vkDestroyCommandPool(m_device, frame.upload_command_pool, nullptr);
         }
 
-        vkDestroySemaphore(m_device, m_submit_semaphore, nullptr);
+        for (const QueueData &queue : m_queues)
+        {
+            vkDestroySemaphore(m_device, queue.timeline_semaphore, nullptr);
+        }
 
+        delete m_staging_ring;
         delete m_descriptor_manager;
 
+        vmaDestroyAllocator(m_allocator);
+
         vkDestroyDevice(m_device, nullptr);
 
         if (m_validation_layers_enabled)
@@ -110,9 +187,135 @@ namespace hyper_rhi
         return m_device;
     }
 
+    bool VulkanGraphicsDevice::descriptor_buffer_supported() const
+    {
+        return m_descriptor_buffer_supported;
+    }
+
+    VmaAllocator VulkanGraphicsDevice::allocator() const
+    {
+        return m_allocator;
+    }
+
+    VulkanDescriptorManager &VulkanGraphicsDevice::descriptor_manager() const
+    {
+        return *m_descriptor_manager;
+    }
+
+    VulkanDeletionQueue &VulkanGraphicsDevice::deletion_queue() const
+    {
+        return *m_deletion_queue;
+    }
+
+    VulkanGpuProfiler &VulkanGraphicsDevice::gpu_profiler() const
+    {
+        return *m_gpu_profiler;
+    }
+
+    MemoryBudgetTracker &VulkanGraphicsDevice::memory_budget()
+    {
+        return m_memory_budget;
+    }
+
+    VulkanPipelineCache &VulkanGraphicsDevice::pipeline_cache() const
+    {
+        return *m_pipeline_cache;
+    }
+
+    const VulkanGraphicsDevice::QueueData &VulkanGraphicsDevice::queue(const QueueType queue_type) const
+    {
+        return m_queues[static_cast<size_t>(queue_type)];
+    }
+
+    const std::vector<uint32_t> &VulkanGraphicsDevice::queue_family_indices() const
+    {
+        return m_queue_family_indices;
+    }
+
     const VulkanGraphicsDevice::FrameData &VulkanGraphicsDevice::current_frame() const
     {
-        return m_frames[m_current_frame_index % GraphicsDevice::s_frame_count];
+        return m_frames[this->current_frame_index() % m_frame_count];
+    }
+
+    uint32_t VulkanGraphicsDevice::current_frame_index() const
+    {
+        return m_current_frame_index.load(std::memory_order_acquire);
+    }
+
+    uint64_t VulkanGraphicsDevice::retire_timeline_value() const
+    {
+        // NOTE: The current frame may already be submitted, so retired objects could still be used by the next one
+        return static_cast<uint64_t>(this->current_frame_index()) + 1;
+    }
+
+    VulkanCommandPool &VulkanGraphicsDevice::command_pool(const QueueType queue_type)
+    {
+        const size_t frame_slot = this->current_frame_index() % m_frame_count;
+
+        const std::lock_guard<std::mutex> lock(m_command_pool_mutex);
+
+        std::unique_ptr<ThreadCommandPools> &thread_command_pools = m_thread_command_pools[std::this_thread::get_id()];
+        if (!thread_command_pools)
+        {
+            thread_command_pools = std::make_unique<ThreadCommandPools>();
+        }
+
+        std::unique_ptr<VulkanCommandPool> &command_pool = (*thread_command_pools)[frame_slot][static_cast<size_t>(queue_type)];
+        if (!command_pool)
+        {
+            command_pool = std::make_unique<VulkanCommandPool>(*this, this->queue(queue_type).family_index);
+        }
+
+        return *command_pool;
+    }
+
+    void VulkanGraphicsDevice::set_object_name(const VkObjectType object_type, const uint64_t object_handle, const std::string_view name) const
+    {
+        if (!m_validation_layers_enabled || name.empty())
+        {
+            return;
+        }
+
+        const std::string object_name(name);
+        const VkDebugUtilsObjectNameInfoEXT object_name_info = {
+            .sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT,
+            .pNext = nullptr,
+            .objectType = object_type,
+            .objectHandle = object_handle,
+            .pObjectName = object_name.c_str(),
+        };
+
+        HE_VK_CHECK(vkSetDebugUtilsObjectNameEXT(m_device, &object_name_info));
+    }
+
+    void VulkanGraphicsDevice::wait_for_timeline_value(const uint64_t value) const
+    {
+        const uint64_t semaphore_value = value << s_timeline_frame_shift;
+        const VkSemaphoreWaitInfo semaphore_wait_info = {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .semaphoreCount = 1,
+            .pSemaphores = &this->queue(QueueType::Graphics).timeline_semaphore,
+            .pValues = &semaphore_value,
+        };
+        HE_VK_CHECK(vkWaitSemaphores(m_device, &semaphore_wait_info, std::numeric_limits<uint64_t>::max()));
+    }
+
+    GraphicsApi VulkanGraphicsDevice::graphics_api() const
+    {
+        return GraphicsApi::Vulkan;
+    }
+
+    bool VulkanGraphicsDevice::buffer_device_address_supported() const
+    {
+        // NOTE: Buffer device addresses are core in Vulkan 1.3, shaders additionally need 64-bit integers to hold them
+        return m_shader_int64_supported;
+    }
+
+    bool VulkanGraphicsDevice::draw_indirect_count_supported() const
+    {
+        return m_draw_indirect_count_supported;
     }
 
     SurfaceHandle VulkanGraphicsDevice::create_surface(const SurfaceDescriptor &descriptor)
@@ -122,83 +325,275 @@ namespace hyper_rhi
 
     BufferHandle VulkanGraphicsDevice::create_buffer(const BufferDescriptor &descriptor)
     {
-        HE_UNUSED(descriptor);
-
-        HE_UNREACHABLE();
+        return std::make_shared<VulkanBuffer>(*this, descriptor);
     }
 
-    CommandListHandle VulkanGraphicsDevice::create_command_list()
+    CommandListHandle VulkanGraphicsDevice::create_command_list(const CommandListDescriptor &descriptor)
     {
-        return std::make_shared<VulkanCommandList>(*this);
+        return std::make_shared<VulkanCommandList>(*this, descriptor);
     }
 
     ComputePipelineHandle VulkanGraphicsDevice::create_compute_pipeline(const ComputePipelineDescriptor &descriptor)
     {
-        HE_UNUSED(descriptor);
-
-        HE_UNREACHABLE();
+        return m_compute_pipelines.get_or_create(
+            object_key(descriptor),
+            [this, &descriptor]()
+            {
+                return std::make_shared<VulkanComputePipeline>(*this, descriptor);
+            });
     }
 
     GraphicsPipelineHandle VulkanGraphicsDevice::create_graphics_pipeline(const GraphicsPipelineDescriptor &descriptor)
     {
-        HE_UNUSED(descriptor);
+        return m_graphics_pipelines.get_or_create(
+            object_key(descriptor),
+            [this, &descriptor]()
+            {
+                return std::make_shared<VulkanGraphicsPipeline>(*this, descriptor);
+            });
+    }
 
-        HE_UNREACHABLE();
+    MemoryHeapHandle VulkanGraphicsDevice::create_memory_heap(const MemoryHeapDescriptor &descriptor)
+    {
+        return std::make_shared<VulkanMemoryHeap>(*this, descriptor);
     }
 
     PipelineLayoutHandle VulkanGraphicsDevice::create_pipeline_layout(const PipelineLayoutDescriptor &descriptor)
     {
-        HE_UNUSED(descriptor);
-
-        HE_UNREACHABLE();
+        return std::make_shared<VulkanPipelineLayout>(*this, descriptor);
     }
 
     ShaderModuleHandle VulkanGraphicsDevice::create_shader_module(const ShaderModuleDescriptor &descriptor)
     {
-        HE_UNUSED(descriptor);
-
-        HE_UNREACHABLE();
+        return std::make_shared<VulkanShaderModule>(*this, descriptor);
     }
 
     TextureHandle VulkanGraphicsDevice::create_texture(const TextureDescriptor &descriptor)
     {
-        HE_UNUSED(descriptor);
+        return std::make_shared<VulkanTexture>(*this, descriptor);
+    }
+
+    TextureViewHandle VulkanGraphicsDevice::create_texture_view(const TextureViewDescriptor &descriptor)
+    {
+        return std::make_shared<VulkanTextureView>(*this, descriptor);
+    }
+
+    std::shared_future<ComputePipelineHandle> VulkanGraphicsDevice::create_compute_pipeline_async(const ComputePipelineDescriptor &descriptor)
+    {
+        if (m_thread_pool == nullptr)
+        {
+            std::promise<ComputePipelineHandle> promise;
+            promise.set_value(this->create_compute_pipeline(descriptor));
+            return promise.get_future().share();
+        }
+
+        // NOTE: Pipeline creation is thread safe, the pipeline cache is internally synchronized
+        return m_thread_pool
+            ->submit(
+                [this, descriptor]()
+                {
+                    return this->create_compute_pipeline(descriptor);
+                })
+            .share();
+    }
+
+    std::shared_future<GraphicsPipelineHandle> VulkanGraphicsDevice::create_graphics_pipeline_async(const GraphicsPipelineDescriptor &descriptor)
+    {
+        if (m_thread_pool == nullptr)
+        {
+            std::promise<GraphicsPipelineHandle> promise;
+            promise.set_value(this->create_graphics_pipeline(descriptor));
+            return promise.get_future().share();
+        }
+
+        return m_thread_pool
+            ->submit(
+                [this, descriptor]()
+                {
+                    return this->create_graphics_pipeline(descriptor);
+                })
+            .share();
+    }
+
+    void VulkanGraphicsDevice::prewarm_pipelines(
+        const std::span<const ComputePipelineDescriptor> compute_pipeline_descriptors,
+        const std::span<const GraphicsPipelineDescriptor> graphics_pipeline_descriptors)
+    {
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+        std::vector<std::shared_future<ComputePipelineHandle>> compute_pipelines;
+        compute_pipelines.reserve(compute_pipeline_descriptors.size());
+        for (const ComputePipelineDescriptor &descriptor : compute_pipeline_descriptors)
+        {
+            compute_pipelines.push_back(this->create_compute_pipeline_async(descriptor));
+        }
+
+        std::vector<std::shared_future<GraphicsPipelineHandle>> graphics_pipelines;
+        graphics_pipelines.reserve(graphics_pipeline_descriptors.size());
+        for (const GraphicsPipelineDescriptor &descriptor : graphics_pipeline_descriptors)
+        {
+            graphics_pipelines.push_back(this->create_graphics_pipeline_async(descriptor));
+        }
+
+        // NOTE: The pipelines only exist to fill the pipeline cache, they are released through the deletion queue
+        for (const std::shared_future<ComputePipelineHandle> &compute_pipeline : compute_pipelines)
+        {
+            compute_pipeline.wait();
+        }
+
+        for (const std::shared_future<GraphicsPipelineHandle> &graphics_pipeline : graphics_pipelines)
+        {
+            graphics_pipeline.wait();
+        }
+
+        const std::chrono::duration<double> elapsed_seconds = std::chrono::steady_clock::now() - start_time;
+        HE_DEBUG(
+            "Prewarmed {} compute and {} graphics pipelines in {:.2}s",
+            compute_pipelines.size(),
+            graphics_pipelines.size(),
+            elapsed_seconds.count());
+    }
+
+    MemoryRequirements VulkanGraphicsDevice::buffer_memory_requirements(const BufferDescriptor &descriptor) const
+    {
+        MemoryRequirements memory_requirements = VulkanBuffer::memory_requirements(*this, descriptor);
+
+        // NOTE: Buffers and textures share memory heaps, aligning both to the granularity keeps neighbours from conflicting
+        memory_requirements.alignment = std::max(memory_requirements.alignment, m_buffer_image_granularity);
+
+        return memory_requirements;
+    }
+
+    MemoryRequirements VulkanGraphicsDevice::texture_memory_requirements(const TextureDescriptor &descriptor) const
+    {
+        MemoryRequirements memory_requirements = VulkanTexture::memory_requirements(*this, descriptor);
+        memory_requirements.alignment = std::max(memory_requirements.alignment, m_buffer_image_granularity);
+
+        return memory_requirements;
+    }
+
+    MemoryStatistics VulkanGraphicsDevice::memory_statistics() const
+    {
+        return m_memory_budget.statistics();
+    }
+
+    void VulkanGraphicsDevice::add_memory_budget_callback(const MemoryBudgetCallbackDescriptor &descriptor)
+    {
+        m_memory_budget.add_callback(descriptor);
+    }
+
+    void VulkanGraphicsDevice::write_buffer(const BufferHandle &buffer_handle, const uint64_t offset, const void *data, const uint64_t byte_size)
+    {
+        const std::shared_ptr<VulkanBuffer> buffer = std::dynamic_pointer_cast<VulkanBuffer>(buffer_handle);
+        HE_ASSERT(offset + byte_size <= buffer->byte_size());
+
+        m_staging_ring->write(buffer->buffer(), offset, data, byte_size);
+    }
+
+    void VulkanGraphicsDevice::set_frame_count(const uint32_t frame_count)
+    {
+        HE_ASSERT(frame_count >= GraphicsDevice::s_min_frame_count && frame_count <= GraphicsDevice::s_max_frame_count);
+
+        if (m_frame_count == frame_count)
+        {
+            return;
+        }
+
+        // NOTE: The frame to slot mapping changes, so no slot may still be in flight
+        this->wait_for_idle();
+
+        m_frame_count = frame_count;
+    }
+
+    uint32_t VulkanGraphicsDevice::frame_count() const
+    {
+        return m_frame_count;
+    }
+
+    void VulkanGraphicsDevice::wait_for_frame(const uint32_t frame_index) const
+    {
+        if (frame_index <= m_frame_count)
+        {
+            return;
+        }
 
-        HE_UNREACHABLE();
+        this->wait_for_timeline_value(static_cast<uint64_t>(frame_index) - m_frame_count);
     }
 
     void VulkanGraphicsDevice::begin_frame(const SurfaceHandle surface_handle, const uint32_t frame_index)
     {
         const std::shared_ptr<VulkanSurface> surface = std::dynamic_pointer_cast<VulkanSurface>(surface_handle);
 
-        m_current_frame_index = frame_index;
+        m_current_frame_index.store(frame_index, std::memory_order_release);
 
-        const uint64_t wait_frame_index = static_cast<uint64_t>(m_current_frame_index) - 1;
-        const VkSemaphoreWaitInfo semaphore_wait_info = {
-            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
-            .pNext = nullptr,
-            .flags = 0,
-            .semaphoreCount = 1,
-            .pSemaphores = &m_submit_semaphore,
-            .pValues = &wait_frame_index,
-        };
-        HE_VK_CHECK(vkWaitSemaphores(m_device, &semaphore_wait_info, std::numeric_limits<uint64_t>::max()));
+        this->wait_for_frame(frame_index);
 
-        // TODO: Add resource cleanup
+        m_gpu_profiler->begin_frame(frame_index);
 
-        if (surface->resized())
         {
-            surface->rebuild();
+            const size_t frame_slot = frame_index % m_frame_count;
+
+            const std::lock_guard<std::mutex> lock(m_command_pool_mutex);
+            for (const auto &thread_command_pools : m_thread_command_pools)
+            {
+                for (const std::unique_ptr<VulkanCommandPool> &command_pool : (*thread_command_pools.second)[frame_slot])
+                {
+                    if (command_pool)
+                    {
+                        command_pool->reset();
+                    }
+                }
+            }
         }
 
+        uint64_t completed_semaphore_value = 0;
+        HE_VK_CHECK(vkGetSemaphoreCounterValue(m_device, this->queue(QueueType::Graphics).timeline_semaphore, &completed_semaphore_value));
+
+        // NOTE: Values between two frame boundaries belong to a partially executed frame
+        const uint64_t completed_timeline_value = completed_semaphore_value >> s_timeline_frame_shift;
+
+        // NOTE: Pending descriptor writes may still reference resources that are about to be destroyed
+        m_descriptor_manager->flush_writes();
+
+        m_staging_ring->recycle(completed_timeline_value);
+        m_descriptor_manager->recycle(completed_timeline_value);
+        m_deletion_queue->flush(completed_timeline_value);
+
+        this->update_memory_budget();
+
         uint32_t image_index = 0;
-        HE_VK_CHECK(vkAcquireNextImageKHR(
-            m_device,
-            surface->swapchain(),
-            std::numeric_limits<uint64_t>::max(),
-            this->current_frame().present_semaphore,
-            VK_NULL_HANDLE,
-            &image_index));
+        while (true)
+        {
+            if (surface->rebuild_requested())
+            {
+                surface->rebuild();
+            }
+
+            const VkResult result = vkAcquireNextImageKHR(
+                m_device,
+                surface->swapchain(),
+                std::numeric_limits<uint64_t>::max(),
+                this->current_frame().present_semaphore,
+                VK_NULL_HANDLE,
+                &image_index);
+
+            // NOTE: No image was acquired and the semaphore stays unsignaled, so the swapchain is rebuilt and the acquire retried
+            if (result == VK_ERROR_OUT_OF_DATE_KHR)
+            {
+                surface->request_rebuild();
+                continue;
+            }
+
+            // NOTE: A suboptimal image is still usable, the swapchain is rebuilt at the start of the next frame
+            if (result == VK_SUBOPTIMAL_KHR)
+            {
+                surface->request_rebuild();
+                break;
+            }
+
+            HE_VK_CHECK(result);
+            break;
+        }
 
         surface->set_current_texture_index(image_index);
     }
@@ -208,60 +603,180 @@ namespace hyper_rhi
         // NOTE: Do nothing for now
     }
 
-    void VulkanGraphicsDevice::execute() const
+    void VulkanGraphicsDevice::execute(const std::span<const SubmitDescriptor> submit_descriptors) const
     {
-        const VkSemaphoreSubmitInfo semaphore_submit_info = {
-            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
-            .pNext = nullptr,
-            .semaphore = this->current_frame().present_semaphore,
-            .value = 0,
-            .stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
-            .deviceIndex = 0,
+        HE_ASSERT(m_executed_frame_index != this->current_frame_index(), "Frame {} was executed more than once", this->current_frame_index());
+        m_executed_frame_index = this->current_frame_index();
+
+        // NOTE: Resources created while recording need their descriptors before the work is submitted
+        m_descriptor_manager->flush_writes();
+
+        const FrameData &frame = this->current_frame();
+
+        const auto signal_timeline = [this](SubmitBatch &submit_batch, const QueueType queue_type, const uint64_t value)
+        {
+            // NOTE: A batch signals its queue timeline once, a later value also satisfies every wait on an earlier one
+            const VkSemaphore timeline_semaphore = this->queue(queue_type).timeline_semaphore;
+            for (VkSemaphoreSubmitInfo &signal_semaphore_submit_info : submit_batch.signal_semaphore_submit_infos)
+            {
+                if (signal_semaphore_submit_info.semaphore == timeline_semaphore)
+                {
+                    signal_semaphore_submit_info.value = value;
+                    return;
+                }
+            }
+
+            submit_batch.signal_semaphore_submit_infos.push_back(
+                this->timeline_submit_info(queue_type, value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
         };
 
-        const VkCommandBufferSubmitInfo command_buffer_submit_info = {
-            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+        std::array<std::vector<SubmitBatch>, GraphicsDevice::s_queue_type_count> queue_submit_batches = {};
+        std::array<size_t, GraphicsDevice::s_queue_type_count> first_submit_batches = {};
+
+        HE_VK_CHECK(vkResetCommandBuffer(frame.upload_command_buffer, 0));
+
+        constexpr VkCommandBufferBeginInfo command_buffer_begin_info = {
+            .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
             .pNext = nullptr,
-            .commandBuffer = this->current_frame().command_buffer,
-            .deviceMask = 0,
+            .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+            .pInheritanceInfo = nullptr,
         };
+        HE_VK_CHECK(vkBeginCommandBuffer(frame.upload_command_buffer, &command_buffer_begin_info));
+
+        const bool uploads_recorded = m_staging_ring->record(frame.upload_command_buffer, this->current_frame_index());
+
+        HE_VK_CHECK(vkEndCommandBuffer(frame.upload_command_buffer));
 
-        const VkSemaphoreSubmitInfo submit_semaphore_submit_info = {
+        // NOTE: Uploads get their own transfer batch, the first batch of every queue waits for it
+        if (uploads_recorded)
+        {
+            SubmitBatch upload_submit_batch = {};
+            upload_submit_batch.command_buffer_submit_infos.push_back({
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+                .pNext = nullptr,
+                .commandBuffer = frame.upload_command_buffer,
+                .deviceMask = 0,
+            });
+
+            // NOTE: Earlier frames may still read the destinations, the frame completion value covers the work of every queue
+            const uint64_t previous_frame_value = static_cast<uint64_t>(this->current_frame_index() - 1) << s_timeline_frame_shift;
+            upload_submit_batch.wait_semaphore_submit_infos.push_back(
+                this->timeline_submit_info(QueueType::Graphics, previous_frame_value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+
+            signal_timeline(upload_submit_batch, QueueType::Transfer, this->frame_timeline_value(0));
+
+            queue_submit_batches[static_cast<size_t>(QueueType::Transfer)].push_back(std::move(upload_submit_batch));
+            first_submit_batches[static_cast<size_t>(QueueType::Transfer)] = 1;
+        }
+
+        std::array<uint64_t, GraphicsDevice::s_queue_type_count> last_signal_values = {};
+        for (const SubmitDescriptor &submit_descriptor : submit_descriptors)
+        {
+            const std::shared_ptr<VulkanCommandList> command_list = std::dynamic_pointer_cast<VulkanCommandList>(submit_descriptor.command_list);
+            HE_ASSERT(command_list);
+
+            const QueueType queue_type = submit_descriptor.command_list->queue_type();
+            std::vector<SubmitBatch> &submit_batches = queue_submit_batches[static_cast<size_t>(queue_type)];
+
+            // NOTE: Waits apply to the whole batch, so a waiting list only joins a batch that has no command buffers yet
+            const bool joins_batch = submit_batches.size() > first_submit_batches[static_cast<size_t>(queue_type)] &&
+                                     (submit_descriptor.wait_points.empty() || submit_batches.back().command_buffer_submit_infos.empty());
+            if (!joins_batch)
+            {
+                submit_batches.emplace_back();
+            }
+
+            SubmitBatch &submit_batch = submit_batches.back();
+            for (const TimelinePoint &wait_point : submit_descriptor.wait_points)
+            {
+                HE_ASSERT(wait_point.value > 0 && wait_point.value < (uint64_t(1) << s_timeline_frame_shift) - 1);
+
+                const uint64_t wait_value = this->frame_timeline_value(wait_point.value);
+                submit_batch.wait_semaphore_submit_infos.push_back(
+                    this->timeline_submit_info(wait_point.queue_type, wait_value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+            }
+
+            submit_batch.command_buffer_submit_infos.push_back({
+                .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO,
+                .pNext = nullptr,
+                .commandBuffer = command_list->command_buffer(),
+                .deviceMask = 0,
+            });
+
+            if (submit_descriptor.signal_value != 0)
+            {
+                uint64_t &last_signal_value = last_signal_values[static_cast<size_t>(queue_type)];
+                HE_ASSERT(
+                    submit_descriptor.signal_value > last_signal_value &&
+                        submit_descriptor.signal_value < (uint64_t(1) << s_timeline_frame_shift) - 1,
+                    "Timeline values must increase along the submission order of a queue");
+
+                last_signal_value = submit_descriptor.signal_value;
+                signal_timeline(submit_batch, queue_type, this->frame_timeline_value(submit_descriptor.signal_value));
+            }
+        }
+
+        // NOTE: The graphics queue always submits, it owns the swapchain semaphores and the frame completion value
+        std::vector<SubmitBatch> &graphics_submit_batches = queue_submit_batches[static_cast<size_t>(QueueType::Graphics)];
+        if (graphics_submit_batches.empty())
+        {
+            graphics_submit_batches.emplace_back();
+        }
+
+        graphics_submit_batches.front().wait_semaphore_submit_infos.push_back({
             .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
             .pNext = nullptr,
-            .semaphore = m_submit_semaphore,
-            .value = m_current_frame_index,
+            .semaphore = frame.present_semaphore,
+            .value = 0,
             .stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
             .deviceIndex = 0,
-        };
+        });
 
-        const VkSemaphoreSubmitInfo render_semaphore_submit_info = {
+        graphics_submit_batches.back().signal_semaphore_submit_infos.push_back({
             .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
             .pNext = nullptr,
-            .semaphore = this->current_frame().render_semaphore,
+            .semaphore = frame.render_semaphore,
             .value = 0,
             .stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
             .deviceIndex = 0,
-        };
+        });
 
-        const std::array<VkSemaphoreSubmitInfo, 2> signal_semaphore_submit_infos = {
-            submit_semaphore_submit_info,
-            render_semaphore_submit_info,
-        };
+        const uint64_t frame_completion_value = static_cast<uint64_t>(this->current_frame_index()) << s_timeline_frame_shift;
 
-        const VkSubmitInfo2 submit_info = {
-            .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
-            .pNext = nullptr,
-            .flags = 0,
-            .waitSemaphoreInfoCount = 1,
-            .pWaitSemaphoreInfos = &semaphore_submit_info,
-            .commandBufferInfoCount = 1,
-            .pCommandBufferInfos = &command_buffer_submit_info,
-            .signalSemaphoreInfoCount = static_cast<uint32_t>(signal_semaphore_submit_infos.size()),
-            .pSignalSemaphoreInfos = signal_semaphore_submit_infos.data(),
-        };
+        // NOTE: Frame pacing, recycling and the deletion queue only read the graphics timeline, so its completion value has to cover every queue
+        SubmitBatch completion_submit_batch = {};
+        for (const QueueType queue_type : { QueueType::Compute, QueueType::Transfer })
+        {
+            if (!queue_submit_batches[static_cast<size_t>(queue_type)].empty())
+            {
+                completion_submit_batch.wait_semaphore_submit_infos.push_back(
+                    this->timeline_submit_info(queue_type, frame_completion_value, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+            }
+        }
 
-        HE_VK_CHECK(vkQueueSubmit2(m_queue, 1, &submit_info, VK_NULL_HANDLE));
+        if (!completion_submit_batch.wait_semaphore_submit_infos.empty())
+        {
+            graphics_submit_batches.push_back(std::move(completion_submit_batch));
+        }
+
+        for (size_t queue_index = 0; queue_index < GraphicsDevice::s_queue_type_count; ++queue_index)
+        {
+            std::vector<SubmitBatch> &submit_batches = queue_submit_batches[queue_index];
+            if (submit_batches.empty())
+            {
+                continue;
+            }
+
+            if (uploads_recorded && submit_batches.size() > first_submit_batches[queue_index])
+            {
+                submit_batches[first_submit_batches[queue_index]].wait_semaphore_submit_infos.push_back(
+                    this->timeline_submit_info(QueueType::Transfer, this->frame_timeline_value(0), VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT));
+            }
+
+            signal_timeline(submit_batches.back(), static_cast<QueueType>(queue_index), frame_completion_value);
+        }
+
+        this->submit_queues(queue_submit_batches);
     }
 
     void VulkanGraphicsDevice::present(const SurfaceHandle surface_handle) const
@@ -282,7 +797,14 @@ namespace hyper_rhi
             .pResults = nullptr,
         };
 
-        HE_VK_CHECK(vkQueuePresentKHR(m_queue, &present_info));
+        const VkResult result = vkQueuePresentKHR(this->queue(QueueType::Graphics).queue, &present_info);
+        if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+        {
+            surface->request_rebuild();
+            return;
+        }
+
+        HE_VK_CHECK(result);
     }
 
     void VulkanGraphicsDevice::wait_for_idle() const
@@ -396,7 +918,7 @@ namespace hyper_rhi
         HE_ASSERT(m_debug_messenger != VK_NULL_HANDLE);
     }
 
-    void VulkanGraphicsDevice::choose_physical_device()
+    void VulkanGraphicsDevice::choose_physical_device(const std::string_view adapter)
     {
         uint32_t device_count = 0;
         HE_VK_CHECK(vkEnumeratePhysicalDevices(m_instance, &device_count, nullptr));
@@ -404,23 +926,71 @@ namespace hyper_rhi
         std::vector<VkPhysicalDevice> physical_devices(device_count);
         HE_VK_CHECK(vkEnumeratePhysicalDevices(m_instance, &device_count, physical_devices.data()));
 
-        std::multimap<uint32_t, VkPhysicalDevice> possible_physical_devices = {};
-        for (const VkPhysicalDevice &physical_device : physical_devices)
+        std::vector<PhysicalDeviceCapabilities> candidates;
+        for (uint32_t index = 0; index < device_count; ++index)
         {
-            const uint32_t score = VulkanGraphicsDevice::rate_physical_device(physical_device);
-            possible_physical_devices.insert({ score, physical_device });
+            std::optional<PhysicalDeviceCapabilities> capabilities = this->query_capabilities(physical_devices[index], index);
+            if (!capabilities.has_value())
+            {
+                HE_DEBUG("Skipping GPU #{}, it lacks the required queues, extensions or features", index);
+                continue;
+            }
+
+            HE_DEBUG(
+                "Rated GPU #{} '{}' with {}",
+                capabilities->index,
+                capabilities->name,
+                VulkanGraphicsDevice::rate_physical_device(*capabilities));
+            candidates.push_back(std::move(capabilities.value()));
         }
 
-        HE_ASSERT(possible_physical_devices.rbegin()->first != 0);
+        HE_ASSERT(!candidates.empty(), "No GPU supports the required queues, extensions and features");
+
+        auto chosen = std::max_element(
+            candidates.begin(),
+            candidates.end(),
+            [](const PhysicalDeviceCapabilities &left, const PhysicalDeviceCapabilities &right)
+            {
+                return VulkanGraphicsDevice::rate_physical_device(left) < VulkanGraphicsDevice::rate_physical_device(right);
+            });
+
+        if (!adapter.empty())
+        {
+            const auto selected = std::find_if(
+                candidates.begin(),
+                candidates.end(),
+                [&adapter](const PhysicalDeviceCapabilities &capabilities)
+                {
+                    return matches_adapter(capabilities, adapter);
+                });
+
+            if (selected != candidates.end())
+            {
+                chosen = selected;
+            }
+            else
+            {
+                HE_WARN("No suitable GPU matches '{}', falling back to the highest rated one", adapter);
+            }
+        }
 
-        m_physical_device = possible_physical_devices.rbegin()->second;
+        const PhysicalDeviceCapabilities &capabilities = *chosen;
+        m_physical_device = physical_devices[capabilities.index];
 
         VkPhysicalDeviceProperties properties = {};
         vkGetPhysicalDeviceProperties(m_physical_device, &properties);
 
-        const std::string_view device_type = [&properties]()
+        m_buffer_image_granularity = properties.limits.bufferImageGranularity;
+        m_timestamp_period = properties.limits.timestampPeriod;
+        m_pipeline_statistics_supported = capabilities.pipeline_statistics;
+        m_shader_int64_supported = capabilities.shader_int64;
+        m_memory_budget_supported = capabilities.memory_budget;
+        m_descriptor_buffer_supported = capabilities.descriptor_buffer;
+        m_draw_indirect_count_supported = capabilities.draw_indirect_count;
+
+        const std::string_view device_type = [&capabilities]()
         {
-            switch (properties.deviceType)
+            switch (capabilities.type)
             {
             case VK_PHYSICAL_DEVICE_TYPE_OTHER:
                 return "Other";
@@ -437,66 +1007,167 @@ namespace hyper_rhi
             }
         }();
 
-        HE_INFO("Device Info:");
-        HE_INFO("\tName: {}", properties.deviceName);
         HE_INFO(
-            "\tAPI Version: {}.{}.{}",
-            VK_VERSION_MAJOR(properties.apiVersion),
-            VK_VERSION_MINOR(properties.apiVersion),
-            VK_VERSION_PATCH(properties.apiVersion));
-        HE_INFO("\tType: {}", device_type);
+            "Selected GPU #{} '{}': type={}, api={}.{}.{}, device_local_memory={} MiB, async_compute={}, async_transfer={}, subgroup_size={}, "
+            "pipeline_statistics={}, shader_int64={}, memory_budget={}, descriptor_buffer={}, draw_indirect_count={}, score={}",
+            capabilities.index,
+            capabilities.name,
+            device_type,
+            VK_VERSION_MAJOR(capabilities.api_version),
+            VK_VERSION_MINOR(capabilities.api_version),
+            VK_VERSION_PATCH(capabilities.api_version),
+            capabilities.device_local_memory / (1024 * 1024),
+            capabilities.async_compute,
+            capabilities.async_transfer,
+            capabilities.subgroup_size,
+            capabilities.pipeline_statistics,
+            capabilities.shader_int64,
+            capabilities.memory_budget,
+            capabilities.descriptor_buffer,
+            capabilities.draw_indirect_count,
+            VulkanGraphicsDevice::rate_physical_device(capabilities));
     }
 
-    uint32_t VulkanGraphicsDevice::rate_physical_device(const VkPhysicalDevice &physical_device) const
+    std::optional<VulkanGraphicsDevice::PhysicalDeviceCapabilities> VulkanGraphicsDevice::query_capabilities(
+        const VkPhysicalDevice &physical_device,
+        const uint32_t index) const
     {
-        uint32_t score = 0;
-
-        const std::optional<uint32_t> queue_family = this->find_queue_family(physical_device);
-        if (!queue_family.has_value())
+        const std::optional<QueueFamilies> queue_families = this->find_queue_families(physical_device);
+        if (!queue_families.has_value())
         {
-            return 0;
+            return std::nullopt;
         }
 
         const bool extensions_supported = VulkanGraphicsDevice::check_extension_support(physical_device);
         if (!extensions_supported)
         {
-            return 0;
+            return std::nullopt;
         }
 
         const bool features_supported = VulkanGraphicsDevice::check_feature_support(physical_device);
         if (!features_supported)
         {
-            return 0;
+            return std::nullopt;
         }
 
-        VkPhysicalDeviceProperties device_properties = {};
-        vkGetPhysicalDeviceProperties(physical_device, &device_properties);
+        VkPhysicalDeviceSubgroupProperties subgroup_properties = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES,
+            .pNext = nullptr,
+            .subgroupSize = 0,
+            .supportedStages = 0,
+            .supportedOperations = 0,
+            .quadOperationsInAllStages = VK_FALSE,
+        };
+
+        VkPhysicalDeviceProperties2 properties = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+            .pNext = &subgroup_properties,
+            .properties = {},
+        };
+        vkGetPhysicalDeviceProperties2(physical_device, &properties);
+
+        VkPhysicalDeviceMemoryProperties memory_properties = {};
+        vkGetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
+
+        uint64_t device_local_memory = 0;
+        for (uint32_t heap_index = 0; heap_index < memory_properties.memoryHeapCount; ++heap_index)
+        {
+            const VkMemoryHeap &memory_heap = memory_properties.memoryHeaps[heap_index];
+            if (memory_heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+            {
+                device_local_memory = std::max(device_local_memory, memory_heap.size);
+            }
+        }
+
+        // NOTE: Queue types without a dedicated family fall back to the graphics family, so they can't run asynchronously
+        return PhysicalDeviceCapabilities{
+            .index = index,
+            .name = properties.properties.deviceName,
+            .type = properties.properties.deviceType,
+            .api_version = properties.properties.apiVersion,
+            .device_local_memory = device_local_memory,
+            .async_compute = queue_families->compute != queue_families->graphics,
+            .async_transfer = queue_families->transfer != queue_families->graphics && queue_families->transfer != queue_families->compute,
+            .subgroup_size = subgroup_properties.subgroupSize,
+            .pipeline_statistics = VulkanGraphicsDevice::check_pipeline_statistics_support(physical_device),
+            .shader_int64 = VulkanGraphicsDevice::check_shader_int64_support(physical_device),
+            .memory_budget = VulkanGraphicsDevice::check_device_extension_support(physical_device, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME),
+            .descriptor_buffer = VulkanGraphicsDevice::check_descriptor_buffer_support(physical_device),
+            .draw_indirect_count =
+                VulkanGraphicsDevice::check_device_extension_support(physical_device, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME),
+        };
+    }
+
+    uint32_t VulkanGraphicsDevice::rate_physical_device(const PhysicalDeviceCapabilities &capabilities)
+    {
+        uint32_t score = 0;
 
-        switch (device_properties.deviceType)
+        switch (capabilities.type)
         {
         case VK_PHYSICAL_DEVICE_TYPE_OTHER:
             score += 0;
             break;
         case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:
-            score += 500;
+            score += 5000;
             break;
         case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:
-            score += 1000;
+            score += 10000;
             break;
         case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:
-            score += 250;
+            score += 2500;
             break;
         case VK_PHYSICAL_DEVICE_TYPE_CPU:
-            score += 100;
+            score += 1000;
             break;
         default:
             HE_UNREACHABLE();
         }
 
+        // NOTE: One point per 64 MiB of device local memory, capped so memory never outweighs the device type
+        constexpr uint64_t memory_granularity = 64 * 1024 * 1024;
+        score += static_cast<uint32_t>(std::min<uint64_t>(capabilities.device_local_memory / memory_granularity, 2000));
+
+        if (capabilities.async_compute)
+        {
+            score += 250;
+        }
+
+        if (capabilities.async_transfer)
+        {
+            score += 150;
+        }
+
+        score += capabilities.subgroup_size;
+
+        if (capabilities.pipeline_statistics)
+        {
+            score += 25;
+        }
+
+        if (capabilities.shader_int64)
+        {
+            score += 50;
+        }
+
+        if (capabilities.memory_budget)
+        {
+            score += 25;
+        }
+
+        if (capabilities.descriptor_buffer)
+        {
+            score += 50;
+        }
+
+        if (capabilities.draw_indirect_count)
+        {
+            score += 25;
+        }
+
         return score;
     }
 
-    std::optional<uint32_t> VulkanGraphicsDevice::find_queue_family(const VkPhysicalDevice &physical_device) const
+    std::optional<VulkanGraphicsDevice::QueueFamilies> VulkanGraphicsDevice::find_queue_families(const VkPhysicalDevice &physical_device) const
     {
         uint32_t queue_family_count = 0;
         vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &queue_family_count, nullptr);
@@ -504,21 +1175,56 @@ namespace hyper_rhi
         std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
         vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &queue_family_count, queue_families.data());
 
-        uint32_t index = 0;
-        for (const VkQueueFamilyProperties &queue_family : queue_families)
+        std::optional<uint32_t> graphics_family = std::nullopt;
+        std::optional<uint32_t> compute_family = std::nullopt;
+        std::optional<uint32_t> transfer_family = std::nullopt;
+        std::optional<uint32_t> fallback_transfer_family = std::nullopt;
+
+        for (uint32_t index = 0; index < queue_family_count; ++index)
         {
-            const bool graphics_supported = queue_family.queueFlags & VK_QUEUE_GRAPHICS_BIT;
-            const bool present_supported = glfwGetPhysicalDevicePresentationSupport(m_instance, physical_device, index);
+            const VkQueueFlags queue_flags = queue_families[index].queueFlags;
+            const bool graphics_supported = queue_flags & VK_QUEUE_GRAPHICS_BIT;
+            const bool compute_supported = queue_flags & VK_QUEUE_COMPUTE_BIT;
+            const bool transfer_supported = queue_flags & VK_QUEUE_TRANSFER_BIT;
+
+            if (graphics_supported)
+            {
+                const bool present_supported = glfwGetPhysicalDevicePresentationSupport(m_instance, physical_device, index);
+                if (present_supported && !graphics_family.has_value())
+                {
+                    graphics_family = index;
+                }
+
+                continue;
+            }
+
+            if (compute_supported && !compute_family.has_value())
+            {
+                compute_family = index;
+            }
+
+            if (transfer_supported && !compute_supported && !transfer_family.has_value())
+            {
+                transfer_family = index;
+            }
 
-            if (graphics_supported && present_supported)
+            if (transfer_supported && !fallback_transfer_family.has_value())
             {
-                return index;
+                fallback_transfer_family = index;
             }
+        }
 
-            ++index;
+        if (!graphics_family.has_value())
+        {
+            return std::nullopt;
         }
 
-        return std::nullopt;
+        // NOTE: Queue types without a dedicated family share the graphics family
+        return QueueFamilies{
+            .graphics = graphics_family.value(),
+            .compute = compute_family.value_or(graphics_family.value()),
+            .transfer = transfer_family.value_or(fallback_transfer_family.value_or(graphics_family.value())),
+        };
     }
 
     bool VulkanGraphicsDevice::check_extension_support(const VkPhysicalDevice &physical_device)
@@ -540,9 +1246,15 @@ namespace hyper_rhi
 
     bool VulkanGraphicsDevice::check_feature_support(const VkPhysicalDevice &physical_device)
     {
+        VkPhysicalDeviceHostQueryResetFeatures host_query_reset = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES,
+            .pNext = nullptr,
+            .hostQueryReset = VK_FALSE,
+        };
+
         VkPhysicalDeviceDynamicRenderingFeatures dynamic_rendering = {
             .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES,
-            .pNext = nullptr,
+            .pNext = &host_query_reset,
             .dynamicRendering = VK_FALSE,
         };
 
@@ -590,6 +1302,7 @@ namespace hyper_rhi
         };
         vkGetPhysicalDeviceFeatures2(physical_device, &device_features);
 
+        const bool host_query_reset_supported = host_query_reset.hostQueryReset;
         const bool dynamic_rendering_supported = dynamic_rendering.dynamicRendering;
         const bool timeline_semaphore_supported = timeline_semaphore.timelineSemaphore;
         const bool synchronization2_supported = synchronization2.synchronization2;
@@ -602,17 +1315,113 @@ namespace hyper_rhi
             descriptor_indexing.descriptorBindingPartiallyBound & descriptor_indexing.descriptorBindingVariableDescriptorCount &
             descriptor_indexing.runtimeDescriptorArray;
 
-        const bool features_supported =
-            dynamic_rendering_supported & timeline_semaphore_supported & synchronization2_supported & descriptor_indexing_supported;
+        const bool multi_draw_indirect_supported =
+            device_features.features.multiDrawIndirect & device_features.features.drawIndirectFirstInstance;
+
+        const bool features_supported = host_query_reset_supported & dynamic_rendering_supported & timeline_semaphore_supported &
+                                        synchronization2_supported & descriptor_indexing_supported & multi_draw_indirect_supported;
 
         return features_supported;
     }
 
+    bool VulkanGraphicsDevice::check_pipeline_statistics_support(const VkPhysicalDevice &physical_device)
+    {
+        VkPhysicalDeviceFeatures device_features = {};
+        vkGetPhysicalDeviceFeatures(physical_device, &device_features);
+
+        return device_features.pipelineStatisticsQuery;
+    }
+
+    bool VulkanGraphicsDevice::check_shader_int64_support(const VkPhysicalDevice &physical_device)
+    {
+        VkPhysicalDeviceFeatures device_features = {};
+        vkGetPhysicalDeviceFeatures(physical_device, &device_features);
+
+        return device_features.shaderInt64;
+    }
+
+    bool VulkanGraphicsDevice::check_device_extension_support(const VkPhysicalDevice &physical_device, const std::string_view extension_name)
+    {
+        uint32_t extension_count = 0;
+        HE_VK_CHECK(vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, nullptr));
+
+        std::vector<VkExtensionProperties> extensions(extension_count);
+        HE_VK_CHECK(vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &extension_count, extensions.data()));
+
+        return std::any_of(
+            extensions.begin(),
+            extensions.end(),
+            [&extension_name](const VkExtensionProperties &extension)
+            {
+                return std::string_view(extension.extensionName) == extension_name;
+            });
+    }
+
+    bool VulkanGraphicsDevice::check_descriptor_buffer_support(const VkPhysicalDevice &physical_device)
+    {
+        if (!VulkanGraphicsDevice::check_device_extension_support(physical_device, VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME))
+        {
+            return false;
+        }
+
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptor_buffer = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+            .pNext = nullptr,
+            .descriptorBuffer = VK_FALSE,
+            .descriptorBufferCaptureReplay = VK_FALSE,
+            .descriptorBufferImageLayoutIgnored = VK_FALSE,
+            .descriptorBufferPushDescriptors = VK_FALSE,
+        };
+
+        VkPhysicalDeviceBufferDeviceAddressFeatures buffer_device_address = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES,
+            .pNext = &descriptor_buffer,
+            .bufferDeviceAddress = VK_FALSE,
+            .bufferDeviceAddressCaptureReplay = VK_FALSE,
+            .bufferDeviceAddressMultiDevice = VK_FALSE,
+        };
+
+        VkPhysicalDeviceFeatures2 device_features = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+            .pNext = &buffer_device_address,
+            .features = {},
+        };
+
+        vkGetPhysicalDeviceFeatures2(physical_device, &device_features);
+
+        return descriptor_buffer.descriptorBuffer && buffer_device_address.bufferDeviceAddress;
+    }
+
     void VulkanGraphicsDevice::create_device()
     {
+        // NOTE: The descriptor buffer features may only be chained when the extension is enabled
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT descriptor_buffer = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT,
+            .pNext = nullptr,
+            .descriptorBuffer = VK_TRUE,
+            .descriptorBufferCaptureReplay = VK_FALSE,
+            .descriptorBufferImageLayoutIgnored = VK_FALSE,
+            .descriptorBufferPushDescriptors = VK_FALSE,
+        };
+
+        // NOTE: Buffer device addresses are a required Vulkan 1.3 feature
+        VkPhysicalDeviceBufferDeviceAddressFeatures buffer_device_address = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES,
+            .pNext = m_descriptor_buffer_supported ? &descriptor_buffer : nullptr,
+            .bufferDeviceAddress = VK_TRUE,
+            .bufferDeviceAddressCaptureReplay = VK_FALSE,
+            .bufferDeviceAddressMultiDevice = VK_FALSE,
+        };
+
+        VkPhysicalDeviceHostQueryResetFeatures host_query_reset = {
+            .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES,
+            .pNext = &buffer_device_address,
+            .hostQueryReset = VK_TRUE,
+        };
+
         VkPhysicalDeviceDynamicRenderingFeatures dynamic_rendering = {
             .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES,
-            .pNext = nullptr,
+            .pNext = &host_query_reset,
             .dynamicRendering = VK_TRUE,
         };
 
@@ -653,44 +1462,111 @@ namespace hyper_rhi
             .runtimeDescriptorArray = VK_TRUE,
         };
 
+        // NOTE: Pipeline statistics are optional, the profiler only records timestamps without them
         VkPhysicalDeviceFeatures2 device_features = {
             .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
             .pNext = &descriptor_indexing,
             .features = {},
         };
+        device_features.features.multiDrawIndirect = VK_TRUE;
+        device_features.features.drawIndirectFirstInstance = VK_TRUE;
+        device_features.features.pipelineStatisticsQuery = m_pipeline_statistics_supported ? VK_TRUE : VK_FALSE;
+        device_features.features.shaderInt64 = m_shader_int64_supported ? VK_TRUE : VK_FALSE;
+
+        const QueueFamilies queue_families = this->find_queue_families(m_physical_device).value();
+        const std::array<uint32_t, GraphicsDevice::s_queue_type_count> queue_type_families = {
+            queue_families.graphics,
+            queue_families.compute,
+            queue_families.transfer,
+        };
+
+        uint32_t queue_family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(m_physical_device, &queue_family_count, nullptr);
 
-        const std::optional<uint32_t> queue_family = VulkanGraphicsDevice::find_queue_family(m_physical_device);
+        std::vector<VkQueueFamilyProperties> queue_family_properties(queue_family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(m_physical_device, &queue_family_count, queue_family_properties.data());
 
-        constexpr float queue_priority = 1.0f;
-        const VkDeviceQueueCreateInfo queue_create_info = {
-            .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
-            .pNext = nullptr,
-            .flags = 0,
-            .queueFamilyIndex = queue_family.value(),
-            .queueCount = 1,
-            .pQueuePriorities = &queue_priority,
-        };
+        // NOTE: Queue types sharing a family get their own queue if the family offers enough of them
+        std::map<uint32_t, uint32_t> queue_counts;
+        std::array<uint32_t, GraphicsDevice::s_queue_type_count> queue_type_indices = {};
+        for (size_t queue_type = 0; queue_type < GraphicsDevice::s_queue_type_count; ++queue_type)
+        {
+            const uint32_t family_index = queue_type_families[queue_type];
+            const uint32_t available_queue_count = queue_family_properties[family_index].queueCount;
+
+            uint32_t &queue_count = queue_counts[family_index];
+            queue_type_indices[queue_type] = std::min(queue_count, available_queue_count - 1);
+            queue_count = std::min(queue_count + 1, available_queue_count);
+        }
+
+        constexpr std::array<float, GraphicsDevice::s_queue_type_count> queue_priorities = { 1.0f, 1.0f, 1.0f };
+
+        std::vector<VkDeviceQueueCreateInfo> queue_create_infos;
+        for (const auto &[family_index, queue_count] : queue_counts)
+        {
+            queue_create_infos.push_back({
+                .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+                .pNext = nullptr,
+                .flags = 0,
+                .queueFamilyIndex = family_index,
+                .queueCount = queue_count,
+                .pQueuePriorities = queue_priorities.data(),
+            });
+
+            m_queue_family_indices.push_back(family_index);
+        }
 
         const uint32_t layer_count = m_validation_layers_enabled ? static_cast<uint32_t>(g_validation_layers.size()) : 0;
         const char *const *layers = m_validation_layers_enabled ? g_validation_layers.data() : nullptr;
 
+        std::vector<const char *> extensions(g_device_extensions.begin(), g_device_extensions.end());
+        if (m_memory_budget_supported)
+        {
+            extensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        }
+
+        if (m_descriptor_buffer_supported)
+        {
+            extensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+        }
+
+        // NOTE: The draw count is core in Vulkan 1.2, but only guaranteed when the promoted extension is exposed
+        if (m_draw_indirect_count_supported)
+        {
+            extensions.push_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+        }
+
         const VkDeviceCreateInfo device_create_info = {
             .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
             .pNext = &device_features,
             .flags = 0,
-            .queueCreateInfoCount = 1,
-            .pQueueCreateInfos = &queue_create_info,
+            .queueCreateInfoCount = static_cast<uint32_t>(queue_create_infos.size()),
+            .pQueueCreateInfos = queue_create_infos.data(),
             .enabledLayerCount = layer_count,
             .ppEnabledLayerNames = layers,
-            .enabledExtensionCount = static_cast<uint32_t>(g_device_extensions.size()),
-            .ppEnabledExtensionNames = g_device_extensions.data(),
+            .enabledExtensionCount = static_cast<uint32_t>(extensions.size()),
+            .ppEnabledExtensionNames = extensions.data(),
             .pEnabledFeatures = nullptr,
         };
 
         HE_VK_CHECK(vkCreateDevice(m_physical_device, &device_create_info, nullptr, &m_device));
         HE_ASSERT(m_device != VK_NULL_HANDLE);
 
-        vkGetDeviceQueue(m_device, queue_family.value(), 0, &m_queue);
+        for (size_t queue_type = 0; queue_type < GraphicsDevice::s_queue_type_count; ++queue_type)
+        {
+            QueueData &queue = m_queues[queue_type];
+            queue.family_index = queue_type_families[queue_type];
+
+            vkGetDeviceQueue(m_device, queue.family_index, queue_type_indices[queue_type], &queue.queue);
+            HE_ASSERT(queue.queue != VK_NULL_HANDLE);
+        }
+
+        HE_DEBUG(
+            "Using queue families {} for graphics, {} for compute and {} for transfer",
+            queue_families.graphics,
+            queue_families.compute,
+            queue_families.transfer);
+        HE_DEBUG("Using {} for bindless descriptors", m_descriptor_buffer_supported ? "descriptor buffers" : "descriptor sets");
     }
 
     void VulkanGraphicsDevice::create_allocator()
@@ -724,8 +1600,15 @@ namespace hyper_rhi
             .vkGetDeviceImageMemoryRequirements = vkGetDeviceImageMemoryRequirements,
         };
 
+        // NOTE: Without the extension VMA estimates the budget from the heap sizes and its own allocations
+        VmaAllocatorCreateFlags allocator_flags = VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT;
+        if (m_memory_budget_supported)
+        {
+            allocator_flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+        }
+
         const VmaAllocatorCreateInfo allocator_create_info = {
-            .flags = 0,
+            .flags = allocator_flags,
             .physicalDevice = m_physical_device,
             .device = m_device,
             .preferredLargeHeapBlockSize = 0,
@@ -742,48 +1625,54 @@ namespace hyper_rhi
         HE_ASSERT(m_allocator != VK_NULL_HANDLE);
     }
 
-    void VulkanGraphicsDevice::create_frames()
+    void VulkanGraphicsDevice::create_timeline_semaphores()
     {
-        VkSemaphoreTypeCreateInfo submit_semaphore_type_create_info = {
+        VkSemaphoreTypeCreateInfo semaphore_type_create_info = {
             .sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
             .pNext = nullptr,
             .semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
             .initialValue = 0,
         };
 
-        const VkSemaphoreCreateInfo submit_semaphore_create_info = {
+        const VkSemaphoreCreateInfo semaphore_create_info = {
             .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
-            .pNext = &submit_semaphore_type_create_info,
+            .pNext = &semaphore_type_create_info,
             .flags = 0,
         };
 
-        HE_VK_CHECK(vkCreateSemaphore(m_device, &submit_semaphore_create_info, nullptr, &m_submit_semaphore));
-        HE_ASSERT(m_submit_semaphore != VK_NULL_HANDLE);
-
-        const std::optional<uint32_t> queue_family = VulkanGraphicsDevice::find_queue_family(m_physical_device);
+        for (QueueData &queue : m_queues)
+        {
+            HE_VK_CHECK(vkCreateSemaphore(m_device, &semaphore_create_info, nullptr, &queue.timeline_semaphore));
+            HE_ASSERT(queue.timeline_semaphore != VK_NULL_HANDLE);
+        }
+    }
 
-        for (size_t index = 0; index < GraphicsDevice::s_frame_count; ++index)
+    void VulkanGraphicsDevice::create_frames()
+    {
+        for (size_t index = 0; index < GraphicsDevice::s_max_frame_count; ++index)
         {
-            const VkCommandPoolCreateInfo command_pool_create_info = {
+            FrameData &frame = m_frames[index];
+
+            const VkCommandPoolCreateInfo upload_command_pool_create_info = {
                 .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
                 .pNext = nullptr,
                 .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
-                .queueFamilyIndex = queue_family.value(),
+                .queueFamilyIndex = this->queue(QueueType::Transfer).family_index,
             };
 
-            HE_VK_CHECK(vkCreateCommandPool(m_device, &command_pool_create_info, nullptr, &m_frames[index].command_pool));
-            HE_ASSERT(m_submit_semaphore != VK_NULL_HANDLE);
+            HE_VK_CHECK(vkCreateCommandPool(m_device, &upload_command_pool_create_info, nullptr, &frame.upload_command_pool));
+            HE_ASSERT(frame.upload_command_pool != VK_NULL_HANDLE);
 
-            const VkCommandBufferAllocateInfo command_buffer_allocate_info = {
+            const VkCommandBufferAllocateInfo upload_command_buffer_allocate_info = {
                 .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
                 .pNext = nullptr,
-                .commandPool = m_frames[index].command_pool,
+                .commandPool = frame.upload_command_pool,
                 .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
                 .commandBufferCount = 1,
             };
 
-            HE_VK_CHECK(vkAllocateCommandBuffers(m_device, &command_buffer_allocate_info, &m_frames[index].command_buffer));
-            HE_ASSERT(m_frames[index].command_buffer != VK_NULL_HANDLE);
+            HE_VK_CHECK(vkAllocateCommandBuffers(m_device, &upload_command_buffer_allocate_info, &frame.upload_command_buffer));
+            HE_ASSERT(frame.upload_command_buffer != VK_NULL_HANDLE);
 
             constexpr VkSemaphoreCreateInfo semaphore_create_info = {
                 .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
@@ -791,11 +1680,199 @@ namespace hyper_rhi
                 .flags = 0,
             };
 
-            HE_VK_CHECK(vkCreateSemaphore(m_device, &semaphore_create_info, nullptr, &m_frames[index].render_semaphore));
-            HE_ASSERT(m_frames[index].render_semaphore != VK_NULL_HANDLE);
+            HE_VK_CHECK(vkCreateSemaphore(m_device, &semaphore_create_info, nullptr, &frame.render_semaphore));
+            HE_ASSERT(frame.render_semaphore != VK_NULL_HANDLE);
+
+            HE_VK_CHECK(vkCreateSemaphore(m_device, &semaphore_create_info, nullptr, &frame.present_semaphore));
+            HE_ASSERT(frame.present_semaphore != VK_NULL_HANDLE);
+        }
+    }
+
+    void VulkanGraphicsDevice::update_memory_budget()
+    {
+        // NOTE: VMA only fetches new budgets from the driver when the frame index changes
+        vmaSetCurrentFrameIndex(m_allocator, this->current_frame_index());
+
+        const VkPhysicalDeviceMemoryProperties *memory_properties = nullptr;
+        vmaGetMemoryProperties(m_allocator, &memory_properties);
+
+        std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets = {};
+        vmaGetHeapBudgets(m_allocator, budgets.data());
+
+        std::vector<MemoryHeapBudget> heaps;
+        heaps.reserve(memory_properties->memoryHeapCount);
+
+        for (uint32_t heap_index = 0; heap_index < memory_properties->memoryHeapCount; ++heap_index)
+        {
+            const VmaBudget &budget = budgets[heap_index];
+
+            heaps.push_back({
+                .heap_index = heap_index,
+                .device_local = (memory_properties->memoryHeaps[heap_index].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0,
+                .usage = budget.usage,
+                .budget = budget.budget,
+                .peak_usage = 0,
+                .allocation_byte_size = budget.statistics.allocationBytes,
+                .allocation_count = budget.statistics.allocationCount,
+            });
+        }
+
+        m_memory_budget.update(std::move(heaps));
+    }
+
+    VkSemaphoreSubmitInfo VulkanGraphicsDevice::timeline_submit_info(
+        const QueueType queue_type,
+        const uint64_t value,
+        const VkPipelineStageFlags2 stage_mask) const
+    {
+        return {
+            .sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO,
+            .pNext = nullptr,
+            .semaphore = this->queue(queue_type).timeline_semaphore,
+            .value = value,
+            .stageMask = stage_mask,
+            .deviceIndex = 0,
+        };
+    }
+
+    uint64_t VulkanGraphicsDevice::frame_timeline_value(const uint64_t frame_local_value) const
+    {
+        // NOTE: Local value 0 is reserved for the uploads of the frame
+        return (static_cast<uint64_t>(this->current_frame_index() - 1) << s_timeline_frame_shift) + 1 + frame_local_value;
+    }
+
+    void VulkanGraphicsDevice::submit(const QueueType queue_type, const std::span<const SubmitBatch> submit_batches) const
+    {
+        if (submit_batches.empty())
+        {
+            return;
+        }
+
+        std::vector<VkSubmitInfo2> submit_infos;
+        submit_infos.reserve(submit_batches.size());
+        for (const SubmitBatch &submit_batch : submit_batches)
+        {
+            submit_infos.push_back({
+                .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2,
+                .pNext = nullptr,
+                .flags = 0,
+                .waitSemaphoreInfoCount = static_cast<uint32_t>(submit_batch.wait_semaphore_submit_infos.size()),
+                .pWaitSemaphoreInfos = submit_batch.wait_semaphore_submit_infos.data(),
+                .commandBufferInfoCount = static_cast<uint32_t>(submit_batch.command_buffer_submit_infos.size()),
+                .pCommandBufferInfos = submit_batch.command_buffer_submit_infos.data(),
+                .signalSemaphoreInfoCount = static_cast<uint32_t>(submit_batch.signal_semaphore_submit_infos.size()),
+                .pSignalSemaphoreInfos = submit_batch.signal_semaphore_submit_infos.data(),
+            });
+        }
+
+        HE_VK_CHECK(
+            vkQueueSubmit2(this->queue(queue_type).queue, static_cast<uint32_t>(submit_infos.size()), submit_infos.data(), VK_NULL_HANDLE));
+    }
+
+    void VulkanGraphicsDevice::submit_queues(
+        const std::array<std::vector<SubmitBatch>, GraphicsDevice::s_queue_type_count> &queue_submit_batches) const
+    {
+        constexpr std::array<QueueType, GraphicsDevice::s_queue_type_count> submit_order = {
+            QueueType::Transfer,
+            QueueType::Compute,
+            QueueType::Graphics,
+        };
+
+        // NOTE: Values up to the previous frame boundary were signaled by earlier submissions
+        const uint64_t previous_frame_value = static_cast<uint64_t>(this->current_frame_index() - 1) << s_timeline_frame_shift;
+
+        std::array<bool, GraphicsDevice::s_queue_type_count> submitted_queues = {};
+        for (const QueueType queue_type : submit_order)
+        {
+            if (submitted_queues[static_cast<size_t>(queue_type)])
+            {
+                continue;
+            }
+
+            // NOTE: Queue types share one VkQueue when their family offers too few queues
+            const VkQueue vulkan_queue = this->queue(queue_type).queue;
+
+            std::vector<QueueType> aliased_queues;
+            for (const QueueType other_queue_type : submit_order)
+            {
+                if (this->queue(other_queue_type).queue == vulkan_queue)
+                {
+                    aliased_queues.push_back(other_queue_type);
+                    submitted_queues[static_cast<size_t>(other_queue_type)] = true;
+                }
+            }
+
+            if (aliased_queues.size() == 1)
+            {
+                this->submit(queue_type, queue_submit_batches[static_cast<size_t>(queue_type)]);
+                continue;
+            }
+
+            // NOTE: A batch on a shared queue must never wait for a batch behind it, so the batches are merged in dependency order
+            std::unordered_map<VkSemaphore, uint64_t> signaled_values;
+            const auto is_ready = [&](const SubmitBatch &submit_batch)
+            {
+                return std::all_of(
+                    submit_batch.wait_semaphore_submit_infos.begin(),
+                    submit_batch.wait_semaphore_submit_infos.end(),
+                    [&](const VkSemaphoreSubmitInfo &wait_semaphore_submit_info)
+                    {
+                        const bool aliased_timeline = std::any_of(
+                            aliased_queues.begin(),
+                            aliased_queues.end(),
+                            [&](const QueueType aliased_queue)
+                            {
+                                return this->queue(aliased_queue).timeline_semaphore == wait_semaphore_submit_info.semaphore;
+                            });
+                        if (!aliased_timeline || wait_semaphore_submit_info.value <= previous_frame_value)
+                        {
+                            return true;
+                        }
+
+                        const auto signaled_value = signaled_values.find(wait_semaphore_submit_info.semaphore);
+                        return signaled_value != signaled_values.end() && signaled_value->second >= wait_semaphore_submit_info.value;
+                    });
+            };
+
+            std::vector<SubmitBatch> merged_submit_batches;
+            std::array<size_t, GraphicsDevice::s_queue_type_count> next_batches = {};
+            while (true)
+            {
+                const auto ready_queue = std::find_if(
+                    aliased_queues.begin(),
+                    aliased_queues.end(),
+                    [&](const QueueType aliased_queue)
+                    {
+                        const std::vector<SubmitBatch> &submit_batches = queue_submit_batches[static_cast<size_t>(aliased_queue)];
+                        const size_t next_batch = next_batches[static_cast<size_t>(aliased_queue)];
+                        return next_batch < submit_batches.size() && is_ready(submit_batches[next_batch]);
+                    });
+                if (ready_queue == aliased_queues.end())
+                {
+                    break;
+                }
+
+                size_t &next_batch = next_batches[static_cast<size_t>(*ready_queue)];
+                const SubmitBatch &submit_batch = queue_submit_batches[static_cast<size_t>(*ready_queue)][next_batch];
+                ++next_batch;
+
+                for (const VkSemaphoreSubmitInfo &signal_semaphore_submit_info : submit_batch.signal_semaphore_submit_infos)
+                {
+                    uint64_t &signaled_value = signaled_values[signal_semaphore_submit_info.semaphore];
+                    signaled_value = std::max(signaled_value, signal_semaphore_submit_info.value);
+                }
+
+                merged_submit_batches.push_back(submit_batch);
+            }
+
+            for (const QueueType aliased_queue : aliased_queues)
+            {
+                HE_ASSERT(
+                    next_batches[static_cast<size_t>(aliased_queue)] == queue_submit_batches[static_cast<size_t>(aliased_queue)].size(),
+                    "Submissions on a shared queue wait on each other in a cycle");
+            }
 
-            HE_VK_CHECK(vkCreateSemaphore(m_device, &semaphore_create_info, nullptr, &m_frames[index].present_semaphore));
-            HE_ASSERT(m_frames[index].present_semaphore != VK_NULL_HANDLE);
+            this->submit(queue_type, merged_submit_batches);
         }
     }
 
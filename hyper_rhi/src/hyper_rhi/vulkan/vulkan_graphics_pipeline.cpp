@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_graphics_pipeline.hpp"
+
+#include <array>
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_pipeline_cache.hpp"
+#include "hyper_rhi/vulkan/vulkan_pipeline_layout.hpp"
+#include "hyper_rhi/vulkan/vulkan_shader_module.hpp"
+#include "hyper_rhi/vulkan/vulkan_utils.hpp"
+
+namespace hyper_rhi
+{
+    VulkanGraphicsPipeline::VulkanGraphicsPipeline(VulkanGraphicsDevice &graphics_device, const GraphicsPipelineDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_layout(std::dynamic_pointer_cast<VulkanPipelineLayout>(descriptor.layout))
+        , m_pipeline(VK_NULL_HANDLE)
+    {
+        HE_ASSERT(m_layout != nullptr);
+        HE_ASSERT(descriptor.vertex_shader != nullptr);
+        HE_ASSERT(descriptor.fragment_shader != nullptr);
+
+        const std::shared_ptr<VulkanShaderModule> vertex_shader = std::dynamic_pointer_cast<VulkanShaderModule>(descriptor.vertex_shader);
+        const std::shared_ptr<VulkanShaderModule> fragment_shader =
+            std::dynamic_pointer_cast<VulkanShaderModule>(descriptor.fragment_shader);
+
+        const std::array<VkPipelineShaderStageCreateInfo, 2> shader_stage_create_infos = {
+            vertex_shader->shader_stage_create_info(),
+            fragment_shader->shader_stage_create_info(),
+        };
+
+        // NOTE: Vertices are pulled from bindless buffers, so there is no vertex input state
+        constexpr VkPipelineVertexInputStateCreateInfo vertex_input_state_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .vertexBindingDescriptionCount = 0,
+            .pVertexBindingDescriptions = nullptr,
+            .vertexAttributeDescriptionCount = 0,
+            .pVertexAttributeDescriptions = nullptr,
+        };
+
+        constexpr VkPipelineInputAssemblyStateCreateInfo input_assembly_state_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,
+            .primitiveRestartEnable = VK_FALSE,
+        };
+
+        constexpr VkPipelineViewportStateCreateInfo viewport_state_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .viewportCount = 1,
+            .pViewports = nullptr,
+            .scissorCount = 1,
+            .pScissors = nullptr,
+        };
+
+        constexpr VkPipelineRasterizationStateCreateInfo rasterization_state_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .depthClampEnable = VK_FALSE,
+            .rasterizerDiscardEnable = VK_FALSE,
+            .polygonMode = VK_POLYGON_MODE_FILL,
+            .cullMode = VK_CULL_MODE_NONE,
+            .frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE,
+            .depthBiasEnable = VK_FALSE,
+            .depthBiasConstantFactor = 0.0f,
+            .depthBiasClamp = 0.0f,
+            .depthBiasSlopeFactor = 0.0f,
+            .lineWidth = 1.0f,
+        };
+
+        constexpr VkPipelineMultisampleStateCreateInfo multisample_state_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT,
+            .sampleShadingEnable = VK_FALSE,
+            .minSampleShading = 0.0f,
+            .pSampleMask = nullptr,
+            .alphaToCoverageEnable = VK_FALSE,
+            .alphaToOneEnable = VK_FALSE,
+        };
+
+        const bool depth_enabled = descriptor.depth_attachment_format != TextureFormat::Unknown;
+        const VkPipelineDepthStencilStateCreateInfo depth_stencil_state_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .depthTestEnable = depth_enabled,
+            .depthWriteEnable = depth_enabled,
+            .depthCompareOp = VK_COMPARE_OP_LESS_OR_EQUAL,
+            .depthBoundsTestEnable = VK_FALSE,
+            .stencilTestEnable = VK_FALSE,
+            .front = {},
+            .back = {},
+            .minDepthBounds = 0.0f,
+            .maxDepthBounds = 1.0f,
+        };
+
+        const bool color_enabled = descriptor.color_attachment_format != TextureFormat::Unknown;
+        constexpr VkPipelineColorBlendAttachmentState color_blend_attachment_state = {
+            .blendEnable = VK_FALSE,
+            .srcColorBlendFactor = VK_BLEND_FACTOR_ONE,
+            .dstColorBlendFactor = VK_BLEND_FACTOR_ZERO,
+            .colorBlendOp = VK_BLEND_OP_ADD,
+            .srcAlphaBlendFactor = VK_BLEND_FACTOR_ONE,
+            .dstAlphaBlendFactor = VK_BLEND_FACTOR_ZERO,
+            .alphaBlendOp = VK_BLEND_OP_ADD,
+            .colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT,
+        };
+
+        const VkPipelineColorBlendStateCreateInfo color_blend_state_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .logicOpEnable = VK_FALSE,
+            .logicOp = VK_LOGIC_OP_COPY,
+            .attachmentCount = color_enabled ? 1u : 0u,
+            .pAttachments = color_enabled ? &color_blend_attachment_state : nullptr,
+            .blendConstants = { 0.0f, 0.0f, 0.0f, 0.0f },
+        };
+
+        constexpr std::array<VkDynamicState, 2> dynamic_states = {
+            VK_DYNAMIC_STATE_VIEWPORT,
+            VK_DYNAMIC_STATE_SCISSOR,
+        };
+
+        const VkPipelineDynamicStateCreateInfo dynamic_state_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .dynamicStateCount = static_cast<uint32_t>(dynamic_states.size()),
+            .pDynamicStates = dynamic_states.data(),
+        };
+
+        const VkFormat color_attachment_format = format_to_vulkan(descriptor.color_attachment_format);
+        const VkPipelineRenderingCreateInfo pipeline_rendering_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO,
+            .pNext = nullptr,
+            .viewMask = 0,
+            .colorAttachmentCount = color_enabled ? 1u : 0u,
+            .pColorAttachmentFormats = color_enabled ? &color_attachment_format : nullptr,
+            .depthAttachmentFormat = format_to_vulkan(descriptor.depth_attachment_format),
+            .stencilAttachmentFormat = VK_FORMAT_UNDEFINED,
+        };
+
+        const VkGraphicsPipelineCreateInfo graphics_pipeline_create_info = {
+            .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+            .pNext = &pipeline_rendering_create_info,
+            .flags = m_graphics_device.descriptor_manager().pipeline_create_flags(),
+            .stageCount = static_cast<uint32_t>(shader_stage_create_infos.size()),
+            .pStages = shader_stage_create_infos.data(),
+            .pVertexInputState = &vertex_input_state_create_info,
+            .pInputAssemblyState = &input_assembly_state_create_info,
+            .pTessellationState = nullptr,
+            .pViewportState = &viewport_state_create_info,
+            .pRasterizationState = &rasterization_state_create_info,
+            .pMultisampleState = &multisample_state_create_info,
+            .pDepthStencilState = &depth_stencil_state_create_info,
+            .pColorBlendState = &color_blend_state_create_info,
+            .pDynamicState = &dynamic_state_create_info,
+            .layout = m_layout->pipeline_layout(),
+            .renderPass = VK_NULL_HANDLE,
+            .subpass = 0,
+            .basePipelineHandle = VK_NULL_HANDLE,
+            .basePipelineIndex = -1,
+        };
+
+        HE_VK_CHECK(vkCreateGraphicsPipelines(
+            m_graphics_device.device(), m_graphics_device.pipeline_cache().pipeline_cache(), 1, &graphics_pipeline_create_info, nullptr, &m_pipeline));
+        HE_ASSERT(m_pipeline != VK_NULL_HANDLE);
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_PIPELINE, reinterpret_cast<uint64_t>(m_pipeline), descriptor.label);
+
+        HE_TRACE("Created Graphics Pipeline '{}'", descriptor.label);
+    }
+
+    VulkanGraphicsPipeline::~VulkanGraphicsPipeline()
+    {
+        m_graphics_device.deletion_queue().enqueue(
+            [device = m_graphics_device.device(), pipeline = m_pipeline]()
+            {
+                vkDestroyPipeline(device, pipeline, nullptr);
+            });
+    }
+
+    VkPipelineLayout VulkanGraphicsPipeline::pipeline_layout() const
+    {
+        return m_layout->pipeline_layout();
+    }
+
+    VkPipeline VulkanGraphicsPipeline::pipeline() const
+    {
+        return m_pipeline;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_memory_heap.hpp"
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    VulkanMemoryHeap::VulkanMemoryHeap(VulkanGraphicsDevice &graphics_device, const MemoryHeapDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_byte_size(descriptor.requirements.byte_size)
+        , m_allocation(VK_NULL_HANDLE)
+    {
+        HE_ASSERT(m_byte_size > 0);
+
+        const VkMemoryRequirements memory_requirements = {
+            .size = m_byte_size,
+            .alignment = descriptor.requirements.alignment,
+            .memoryTypeBits = descriptor.requirements.memory_types,
+        };
+
+        // NOTE: The automatic memory usages are only available when VMA knows the resource, so the flags are given explicitly
+        const VmaAllocationCreateInfo allocation_create_info = {
+            .flags = 0,
+            .usage = VMA_MEMORY_USAGE_UNKNOWN,
+            .requiredFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            .preferredFlags = 0,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
+            .priority = 0.0f,
+        };
+
+        HE_VK_CHECK(vmaAllocateMemory(m_graphics_device.allocator(), &memory_requirements, &allocation_create_info, &m_allocation, nullptr));
+        HE_ASSERT(m_allocation != VK_NULL_HANDLE);
+
+        vmaSetAllocationName(m_graphics_device.allocator(), m_allocation, descriptor.label.c_str());
+
+        m_graphics_device.memory_budget().track_allocation(MemoryCategory::Transient, m_byte_size);
+
+        HE_TRACE("Created Memory Heap '{}' with {} bytes", descriptor.label, m_byte_size);
+    }
+
+    VulkanMemoryHeap::~VulkanMemoryHeap()
+    {
+        m_graphics_device.memory_budget().untrack_allocation(MemoryCategory::Transient, m_byte_size);
+
+        m_graphics_device.deletion_queue().enqueue(
+            [allocator = m_graphics_device.allocator(), allocation = m_allocation]()
+            {
+                vmaFreeMemory(allocator, allocation);
+            });
+    }
+
+    VmaAllocation VulkanMemoryHeap::allocation() const
+    {
+        return m_allocation;
+    }
+
+    uint64_t VulkanMemoryHeap::byte_size() const
+    {
+        return m_byte_size;
+    }
+} // namespace hyper_rhi
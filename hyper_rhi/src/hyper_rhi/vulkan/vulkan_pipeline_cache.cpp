@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_pipeline_cache.hpp"
+
+#include <cstring>
+#include <span>
+#include <utility>
+
+#include <hyper_core/filesystem.hpp>
+#include <hyper_core/hash.hpp>
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    VulkanPipelineCache::VulkanPipelineCache(VulkanGraphicsDevice &graphics_device, std::string file_path)
+        : m_graphics_device(graphics_device)
+        , m_file_path(std::move(file_path))
+        , m_pipeline_cache(VK_NULL_HANDLE)
+    {
+        const std::vector<uint8_t> data = this->load();
+
+        const VkPipelineCacheCreateInfo pipeline_cache_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .initialDataSize = data.size(),
+            .pInitialData = data.empty() ? nullptr : data.data(),
+        };
+
+        HE_VK_CHECK(vkCreatePipelineCache(m_graphics_device.device(), &pipeline_cache_create_info, nullptr, &m_pipeline_cache));
+        HE_ASSERT(m_pipeline_cache != VK_NULL_HANDLE);
+    }
+
+    VulkanPipelineCache::~VulkanPipelineCache()
+    {
+        this->save();
+
+        vkDestroyPipelineCache(m_graphics_device.device(), m_pipeline_cache, nullptr);
+    }
+
+    VkPipelineCache VulkanPipelineCache::pipeline_cache() const
+    {
+        return m_pipeline_cache;
+    }
+
+    void VulkanPipelineCache::save() const
+    {
+        if (m_file_path.empty())
+        {
+            return;
+        }
+
+        size_t data_size = 0;
+        HE_VK_CHECK(vkGetPipelineCacheData(m_graphics_device.device(), m_pipeline_cache, &data_size, nullptr));
+
+        std::vector<uint8_t> bytes(sizeof(Header) + data_size);
+        HE_VK_CHECK(vkGetPipelineCacheData(m_graphics_device.device(), m_pipeline_cache, &data_size, bytes.data() + sizeof(Header)));
+        bytes.resize(sizeof(Header) + data_size);
+
+        Header header = this->create_header();
+        header.data_size = data_size;
+        header.data_hash = hyper_core::hash::fnv1a(std::span(bytes.data() + sizeof(Header), data_size));
+        std::memcpy(bytes.data(), &header, sizeof(Header));
+
+        if (!hyper_core::filesystem::write_file(m_file_path, bytes))
+        {
+            HE_WARN("Failed to write pipeline cache to '{}'", m_file_path);
+            return;
+        }
+
+        HE_DEBUG("Saved pipeline cache with {} bytes to '{}'", data_size, m_file_path);
+    }
+
+    VulkanPipelineCache::Header VulkanPipelineCache::create_header() const
+    {
+        VkPhysicalDeviceProperties properties = {};
+        vkGetPhysicalDeviceProperties(m_graphics_device.physical_device(), &properties);
+
+        Header header = {};
+        header.magic = s_magic;
+        header.version = s_version;
+        header.vendor_id = properties.vendorID;
+        header.device_id = properties.deviceID;
+        header.driver_version = properties.driverVersion;
+        std::memcpy(header.pipeline_cache_uuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+        return header;
+    }
+
+    std::vector<uint8_t> VulkanPipelineCache::load() const
+    {
+        if (m_file_path.empty())
+        {
+            return {};
+        }
+
+        const std::vector<uint8_t> bytes = hyper_core::filesystem::read_file(m_file_path);
+        if (bytes.empty())
+        {
+            HE_DEBUG("No pipeline cache found at '{}'", m_file_path);
+            return {};
+        }
+
+        if (bytes.size() < sizeof(Header))
+        {
+            HE_WARN("Ignoring pipeline cache '{}', the file is truncated", m_file_path);
+            return {};
+        }
+
+        Header header = {};
+        std::memcpy(&header, bytes.data(), sizeof(Header));
+
+        const Header expected_header = this->create_header();
+        if (header.magic != expected_header.magic || header.version != expected_header.version)
+        {
+            HE_WARN("Ignoring pipeline cache '{}', the format version is unknown", m_file_path);
+            return {};
+        }
+
+        // NOTE: A cache from another device or driver is not corrupt, just stale
+        if (header.vendor_id != expected_header.vendor_id || header.device_id != expected_header.device_id ||
+            header.driver_version != expected_header.driver_version ||
+            std::memcmp(header.pipeline_cache_uuid, expected_header.pipeline_cache_uuid, VK_UUID_SIZE) != 0)
+        {
+            HE_INFO("Ignoring pipeline cache '{}', it was created by a different device or driver", m_file_path);
+            return {};
+        }
+
+        const std::span<const uint8_t> data(bytes.data() + sizeof(Header), bytes.size() - sizeof(Header));
+        if (header.data_size != data.size() || header.data_hash != hyper_core::hash::fnv1a(data))
+        {
+            HE_WARN("Ignoring pipeline cache '{}', the data is corrupted", m_file_path);
+            return {};
+        }
+
+        HE_DEBUG("Loaded pipeline cache with {} bytes from '{}'", data.size(), m_file_path);
+
+        return { data.begin(), data.end() };
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_pipeline_layout.hpp"
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    VulkanPipelineLayout::VulkanPipelineLayout(VulkanGraphicsDevice &graphics_device, const PipelineLayoutDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_pipeline_layout(VK_NULL_HANDLE)
+    {
+        HE_ASSERT(descriptor.push_constant_size <= VulkanDescriptorManager::s_push_constant_size);
+
+        const auto &descriptor_set_layouts = m_graphics_device.descriptor_manager().descriptor_set_layouts();
+
+        // NOTE: The bindless sets are bound once per command list, which requires the same push constant range in every layout
+        constexpr VkPushConstantRange push_constant_range = {
+            .stageFlags = VK_SHADER_STAGE_ALL,
+            .offset = 0,
+            .size = VulkanDescriptorManager::s_push_constant_size,
+        };
+
+        const VkPipelineLayoutCreateInfo pipeline_layout_create_info = {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .setLayoutCount = static_cast<uint32_t>(descriptor_set_layouts.size()),
+            .pSetLayouts = descriptor_set_layouts.data(),
+            .pushConstantRangeCount = 1,
+            .pPushConstantRanges = &push_constant_range,
+        };
+
+        HE_VK_CHECK(vkCreatePipelineLayout(m_graphics_device.device(), &pipeline_layout_create_info, nullptr, &m_pipeline_layout));
+        HE_ASSERT(m_pipeline_layout != VK_NULL_HANDLE);
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_PIPELINE_LAYOUT, reinterpret_cast<uint64_t>(m_pipeline_layout), descriptor.label);
+
+        HE_TRACE("Created Pipeline Layout '{}' with {} bytes of push constants", descriptor.label, descriptor.push_constant_size);
+    }
+
+    VulkanPipelineLayout::~VulkanPipelineLayout()
+    {
+        m_graphics_device.deletion_queue().enqueue(
+            [device = m_graphics_device.device(), pipeline_layout = m_pipeline_layout]()
+            {
+                vkDestroyPipelineLayout(device, pipeline_layout, nullptr);
+            });
+    }
+
+    VkPipelineLayout VulkanPipelineLayout::pipeline_layout() const
+    {
+        return m_pipeline_layout;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_shader_module.hpp"
+
+#include "hyper_rhi/object_cache.hpp"
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_utils.hpp"
+
+namespace hyper_rhi
+{
+    VulkanShaderModule::VulkanShaderModule(VulkanGraphicsDevice &graphics_device, const ShaderModuleDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_type(descriptor.type)
+        , m_entry_name(descriptor.entry_name)
+        , m_hash(hash_descriptor(descriptor))
+        , m_shader_module(VK_NULL_HANDLE)
+    {
+        HE_ASSERT(m_type != ShaderType::None);
+        HE_ASSERT(
+            !descriptor.bytes.empty() && descriptor.bytes.size() % sizeof(uint32_t) == 0,
+            "Shader module '{}' expects SPIR-V, but got {} bytes",
+            descriptor.label,
+            descriptor.bytes.size());
+
+        const VkShaderModuleCreateInfo shader_module_create_info = {
+            .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .codeSize = descriptor.bytes.size(),
+            .pCode = reinterpret_cast<const uint32_t *>(descriptor.bytes.data()),
+        };
+
+        HE_VK_CHECK(vkCreateShaderModule(m_graphics_device.device(), &shader_module_create_info, nullptr, &m_shader_module));
+        HE_ASSERT(m_shader_module != VK_NULL_HANDLE);
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_SHADER_MODULE, reinterpret_cast<uint64_t>(m_shader_module), descriptor.label);
+
+        HE_TRACE("Created Shader Module '{}' with entry '{}'", descriptor.label, m_entry_name);
+    }
+
+    VulkanShaderModule::~VulkanShaderModule()
+    {
+        // NOTE: Shader modules are only needed while pipelines are created, so they can be destroyed right away
+        vkDestroyShaderModule(m_graphics_device.device(), m_shader_module, nullptr);
+    }
+
+    ShaderType VulkanShaderModule::type() const
+    {
+        return m_type;
+    }
+
+    const std::string &VulkanShaderModule::entry_name() const
+    {
+        return m_entry_name;
+    }
+
+    VkShaderModule VulkanShaderModule::shader_module() const
+    {
+        return m_shader_module;
+    }
+
+    VkPipelineShaderStageCreateInfo VulkanShaderModule::shader_stage_create_info() const
+    {
+        return {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .stage = shader_type_to_vulkan(m_type),
+            .module = m_shader_module,
+            .pName = m_entry_name.c_str(),
+            .pSpecializationInfo = nullptr,
+        };
+    }
+
+    uint64_t VulkanShaderModule::hash() const
+    {
+        return m_hash;
+    }
+} // namespace hyper_rhi
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_staging_ring.hpp"
+
+#include <cstring>
+#include <iterator>
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+
+namespace hyper_rhi
+{
+    static void insert_copy(std::map<uint64_t, VkBufferCopy> &buffer_copies, const VkBufferCopy &buffer_copy)
+    {
+        const uint64_t begin = buffer_copy.dstOffset;
+        const uint64_t end = begin + buffer_copy.size;
+
+        const auto trimmed_tail = [end](const VkBufferCopy &overlapped_copy) -> VkBufferCopy
+        {
+            const uint64_t skipped_size = end - overlapped_copy.dstOffset;
+            return {
+                .srcOffset = overlapped_copy.srcOffset + skipped_size,
+                .dstOffset = end,
+                .size = overlapped_copy.size - skipped_size,
+            };
+        };
+
+        auto iterator = buffer_copies.lower_bound(begin);
+        if (iterator != buffer_copies.begin())
+        {
+            VkBufferCopy &previous_copy = std::prev(iterator)->second;
+            const uint64_t previous_end = previous_copy.dstOffset + previous_copy.size;
+            if (previous_end > begin)
+            {
+                const VkBufferCopy overlapped_copy = previous_copy;
+                previous_copy.size = begin - previous_copy.dstOffset;
+
+                if (previous_end > end)
+                {
+                    buffer_copies.emplace(end, trimmed_tail(overlapped_copy));
+                }
+            }
+        }
+
+        while (iterator != buffer_copies.end() && iterator->first < end)
+        {
+            const VkBufferCopy overlapped_copy = iterator->second;
+            iterator = buffer_copies.erase(iterator);
+
+            if (overlapped_copy.dstOffset + overlapped_copy.size > end)
+            {
+                buffer_copies.emplace(end, trimmed_tail(overlapped_copy));
+                break;
+            }
+        }
+
+        buffer_copies.emplace(begin, buffer_copy);
+    }
+
+    VulkanStagingRing::VulkanStagingRing(VulkanGraphicsDevice &graphics_device, const uint64_t capacity)
+        : m_graphics_device(graphics_device)
+        , m_buffer(VK_NULL_HANDLE)
+        , m_allocation(VK_NULL_HANDLE)
+        , m_mapped_data(nullptr)
+        , m_capacity(capacity)
+        , m_head(0)
+        , m_tail(0)
+        , m_segments()
+        , m_pending_copies()
+        , m_mutex()
+    {
+        const VkBufferCreateInfo buffer_create_info = {
+            .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .size = m_capacity,
+            .usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = 0,
+            .pQueueFamilyIndices = nullptr,
+        };
+
+        constexpr VmaAllocationCreateInfo allocation_create_info = {
+            .flags = VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT,
+            .usage = VMA_MEMORY_USAGE_AUTO_PREFER_HOST,
+            .requiredFlags = 0,
+            .preferredFlags = 0,
+            .memoryTypeBits = 0,
+            .pool = VK_NULL_HANDLE,
+            .pUserData = nullptr,
+            .priority = 0.0f,
+        };
+
+        VmaAllocationInfo allocation_info = {};
+        HE_VK_CHECK(vmaCreateBuffer(
+            m_graphics_device.allocator(), &buffer_create_info, &allocation_create_info, &m_buffer, &m_allocation, &allocation_info));
+        HE_ASSERT(m_buffer != VK_NULL_HANDLE);
+        HE_ASSERT(allocation_info.pMappedData != nullptr);
+
+        m_mapped_data = static_cast<uint8_t *>(allocation_info.pMappedData);
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<uint64_t>(m_buffer), "Staging Ring");
+
+        HE_TRACE("Created Staging Ring with {} bytes", m_capacity);
+    }
+
+    VulkanStagingRing::~VulkanStagingRing()
+    {
+        vmaDestroyBuffer(m_graphics_device.allocator(), m_buffer, m_allocation);
+    }
+
+    void VulkanStagingRing::write(const VkBuffer destination, const uint64_t destination_offset, const void *data, const uint64_t byte_size)
+    {
+        if (byte_size == 0)
+        {
+            return;
+        }
+
+        const std::lock_guard lock(m_mutex);
+
+        const uint64_t offset = this->allocate(byte_size);
+        const uint64_t physical_offset = offset % m_capacity;
+
+        std::memcpy(m_mapped_data + physical_offset, data, byte_size);
+        HE_VK_CHECK(vmaFlushAllocation(m_graphics_device.allocator(), m_allocation, physical_offset, byte_size));
+
+        const VkBufferCopy buffer_copy = {
+            .srcOffset = physical_offset,
+            .dstOffset = destination_offset,
+            .size = byte_size,
+        };
+
+        insert_copy(m_pending_copies[destination], buffer_copy);
+    }
+
+    void VulkanStagingRing::recycle(const uint64_t completed_timeline_value)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        while (!m_segments.empty() && m_segments.front().timeline_value <= completed_timeline_value)
+        {
+            m_tail = m_segments.front().end;
+            m_segments.pop_front();
+        }
+    }
+
+    bool VulkanStagingRing::record(const VkCommandBuffer command_buffer, const uint64_t timeline_value)
+    {
+        const std::lock_guard lock(m_mutex);
+
+        if (m_pending_copies.empty())
+        {
+            return false;
+        }
+
+        // NOTE: The copies run on the transfer queue, the timeline semaphore wait of the consuming queues makes them visible
+        std::vector<VkBufferCopy> buffer_copies;
+        for (auto &[destination, pending_copies] : m_pending_copies)
+        {
+            buffer_copies.clear();
+            for (const auto &[destination_offset, pending_copy] : pending_copies)
+            {
+                if (!buffer_copies.empty())
+                {
+                    VkBufferCopy &previous_copy = buffer_copies.back();
+                    if (previous_copy.srcOffset + previous_copy.size == pending_copy.srcOffset &&
+                        previous_copy.dstOffset + previous_copy.size == pending_copy.dstOffset)
+                    {
+                        previous_copy.size += pending_copy.size;
+                        continue;
+                    }
+                }
+
+                buffer_copies.push_back(pending_copy);
+            }
+
+            vkCmdCopyBuffer(command_buffer, m_buffer, destination, static_cast<uint32_t>(buffer_copies.size()), buffer_copies.data());
+        }
+
+        m_pending_copies.clear();
+        m_segments.push_back({
+            .timeline_value = timeline_value,
+            .end = m_head,
+        });
+
+        return true;
+    }
+
+    uint64_t VulkanStagingRing::allocate(const uint64_t byte_size)
+    {
+        const uint64_t aligned_size = (byte_size + s_alignment - 1) & ~(s_alignment - 1);
+        HE_ASSERT(aligned_size <= m_capacity, "Upload of {} bytes exceeds the staging ring capacity of {} bytes", byte_size, m_capacity);
+
+        // NOTE: Offsets grow monotonically, an allocation never straddles the end of the ring
+        uint64_t offset = m_head;
+        if ((offset % m_capacity) + aligned_size > m_capacity)
+        {
+            offset += m_capacity - (offset % m_capacity);
+        }
+
+        while (offset + aligned_size - m_tail > m_capacity)
+        {
+            HE_ASSERT(!m_segments.empty(), "Staging ring is exhausted by uploads that were not submitted yet");
+
+            const Segment segment = m_segments.front();
+            m_segments.pop_front();
+
+            m_graphics_device.wait_for_timeline_value(segment.timeline_value);
+            m_tail = segment.end;
+        }
+
+        m_head = offset + aligned_size;
+
+        return offset;
+    }
+} // namespace hyper_rhi
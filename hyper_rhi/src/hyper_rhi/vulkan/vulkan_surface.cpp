@@ -10,21 +10,25 @@
 
 #include <GLFW/glfw3.h>
 
+#include "hyper_rhi/vulkan/vulkan_texture.hpp"
+#include "hyper_rhi/vulkan/vulkan_utils.hpp"
+
 namespace hyper_rhi
 {
     VulkanSurface::VulkanSurface(VulkanGraphicsDevice &graphics_device, const SurfaceDescriptor &descriptor)
         : m_graphics_device(graphics_device)
         , m_surface(VK_NULL_HANDLE)
         , m_swapchain(VK_NULL_HANDLE)
+        , m_textures()
         , m_current_texture_index(0)
-        , m_resized(false)
+        , m_rebuild_requested(false)
         , m_width(descriptor.window.width())
         , m_height(descriptor.window.height())
+        , m_present_mode(descriptor.present_mode)
+        , m_format(TextureFormat::Unknown)
     {
         this->create_surface(descriptor.window);
         this->create_swapchain();
-
-        // TODO: Retrieve swapchain images
     }
 
     VulkanSurface::~VulkanSurface()
@@ -36,13 +40,13 @@ namespace hyper_rhi
 
     void VulkanSurface::rebuild()
     {
+        HE_VK_CHECK(vkDeviceWaitIdle(m_graphics_device.device()));
+
         this->destroy();
 
         this->create_swapchain();
 
-        // TODO: Retrieve swapchain images
-
-        m_resized = false;
+        m_rebuild_requested = false;
     }
 
     VkSwapchainKHR VulkanSurface::swapchain() const
@@ -60,21 +64,49 @@ namespace hyper_rhi
         return m_current_texture_index;
     }
 
-    bool VulkanSurface::resized() const
+    void VulkanSurface::request_rebuild()
     {
-        return m_resized;
+        m_rebuild_requested = true;
+    }
+
+    bool VulkanSurface::rebuild_requested() const
+    {
+        return m_rebuild_requested;
     }
 
     void VulkanSurface::resize(const uint32_t width, const uint32_t height)
     {
-        m_resized = true;
+        m_rebuild_requested = true;
         m_width = width;
         m_height = height;
     }
 
+    void VulkanSurface::set_present_mode(const PresentMode present_mode)
+    {
+        if (m_present_mode == present_mode)
+        {
+            return;
+        }
+
+        m_rebuild_requested = true;
+        m_present_mode = present_mode;
+    }
+
+    PresentMode VulkanSurface::present_mode() const
+    {
+        return m_present_mode;
+    }
+
+    TextureFormat VulkanSurface::format() const
+    {
+        return m_format;
+    }
+
     TextureHandle VulkanSurface::current_texture() const
     {
-        HE_UNREACHABLE();
+        HE_ASSERT(m_current_texture_index < m_textures.size());
+
+        return m_textures[m_current_texture_index];
     }
 
     void VulkanSurface::create_surface(const hyper_platform::Window &window)
@@ -97,6 +129,7 @@ namespace hyper_rhi
         HE_VK_CHECK(vkGetPhysicalDeviceSurfaceFormatsKHR(m_graphics_device.physical_device(), m_surface, &format_count, formats.data()));
 
         const VkSurfaceFormatKHR surface_format = VulkanSurface::choose_format(formats);
+        m_format = format_from_vulkan(surface_format.format);
 
         uint32_t present_mode_count = 0;
         HE_VK_CHECK(vkGetPhysicalDeviceSurfacePresentModesKHR(m_graphics_device.physical_device(), m_surface, &present_mode_count, nullptr));
@@ -105,7 +138,7 @@ namespace hyper_rhi
         HE_VK_CHECK(vkGetPhysicalDeviceSurfacePresentModesKHR(
             m_graphics_device.physical_device(), m_surface, &present_mode_count, present_modes.data()));
 
-        const VkPresentModeKHR surface_present_mode = VulkanSurface::choose_present_mode(present_modes);
+        const VkPresentModeKHR surface_present_mode = VulkanSurface::choose_present_mode(present_modes, m_present_mode);
 
         uint32_t image_count = surface_capabilities.minImageCount + 1;
         if (surface_capabilities.maxImageCount > 0 && image_count > surface_capabilities.maxImageCount)
@@ -136,6 +169,36 @@ namespace hyper_rhi
 
         HE_VK_CHECK(vkCreateSwapchainKHR(m_graphics_device.device(), &swapchain_create_info, nullptr, &m_swapchain));
         HE_ASSERT(m_swapchain != VK_NULL_HANDLE);
+
+        uint32_t swapchain_image_count = 0;
+        HE_VK_CHECK(vkGetSwapchainImagesKHR(m_graphics_device.device(), m_swapchain, &swapchain_image_count, nullptr));
+
+        std::vector<VkImage> swapchain_images(swapchain_image_count);
+        HE_VK_CHECK(vkGetSwapchainImagesKHR(m_graphics_device.device(), m_swapchain, &swapchain_image_count, swapchain_images.data()));
+
+        m_textures.reserve(swapchain_image_count);
+        for (uint32_t image_index = 0; image_index < swapchain_image_count; ++image_index)
+        {
+            m_textures.push_back(std::make_shared<VulkanTexture>(
+                m_graphics_device,
+                TextureDescriptor{
+                    .label = fmt::format("Swapchain Texture #{}", image_index),
+                    .width = surface_extent.width,
+                    .height = surface_extent.height,
+                    .depth = 1,
+                    .array_size = 1,
+                    .mip_levels = 1,
+                    .sample_count = 1,
+                    .sample_quality = 0,
+                    .format = m_format,
+                    .dimension = TextureDimension::Texture2D,
+                    .is_render_attachment = true,
+                    .is_storage = false,
+                    .memory_heap = nullptr,
+                    .memory_heap_offset = 0,
+                },
+                swapchain_images[image_index]));
+        }
     }
 
     VkExtent2D VulkanSurface::choose_extent(const uint32_t width, const uint32_t height, const VkSurfaceCapabilitiesKHR &capabilities)
@@ -167,21 +230,44 @@ namespace hyper_rhi
         return formats[0];
     }
 
-    VkPresentModeKHR VulkanSurface::choose_present_mode(const std::vector<VkPresentModeKHR> &present_modes)
+    VkPresentModeKHR VulkanSurface::choose_present_mode(
+        const std::vector<VkPresentModeKHR> &present_modes,
+        const PresentMode requested_present_mode)
     {
+        const VkPresentModeKHR requested_vk_present_mode = [&requested_present_mode]()
+        {
+            switch (requested_present_mode)
+            {
+            case PresentMode::Fifo:
+                return VK_PRESENT_MODE_FIFO_KHR;
+            case PresentMode::FifoRelaxed:
+                return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+            case PresentMode::Mailbox:
+                return VK_PRESENT_MODE_MAILBOX_KHR;
+            case PresentMode::Immediate:
+                return VK_PRESENT_MODE_IMMEDIATE_KHR;
+            default:
+                HE_UNREACHABLE();
+            }
+        }();
+
         for (const VkPresentModeKHR &present_mode : present_modes)
         {
-            if (present_mode == VK_PRESENT_MODE_MAILBOX_KHR)
+            if (present_mode == requested_vk_present_mode)
             {
                 return present_mode;
             }
         }
 
+        HE_WARN("Present mode {} is not supported, falling back to FIFO", HE_VK_TYPE_TO_STRING(VkPresentModeKHR, requested_vk_present_mode));
+
         return VK_PRESENT_MODE_FIFO_KHR;
     }
 
     void VulkanSurface::destroy()
     {
+        m_textures.clear();
+
         vkDestroySwapchainKHR(m_graphics_device.device(), m_swapchain, nullptr);
     }
 } // namespace hyper_rhi
\ No newline at end of file
@@ -0,0 +1,442 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_texture.hpp"
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_memory_heap.hpp"
+#include "hyper_rhi/vulkan/vulkan_utils.hpp"
+
+namespace hyper_rhi
+{
+    VulkanTexture::VulkanTexture(VulkanGraphicsDevice &graphics_device, const TextureDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_format(descriptor.format)
+        , m_width(descriptor.width)
+        , m_height(descriptor.height)
+        , m_dimension(descriptor.dimension)
+        , m_mip_levels(descriptor.mip_levels)
+        , m_array_layers(descriptor.dimension == TextureDimension::Texture3D ? 1 : descriptor.array_size)
+        , m_is_sampled(true)
+        , m_is_storage(descriptor.is_storage)
+        , m_image(VK_NULL_HANDLE)
+        , m_allocation(VK_NULL_HANDLE)
+        , m_memory_heap(descriptor.memory_heap)
+        , m_owned(true)
+        , m_image_view(VK_NULL_HANDLE)
+        , m_sampled_image_view(VK_NULL_HANDLE)
+        , m_storage_image_view(VK_NULL_HANDLE)
+        , m_handle(std::numeric_limits<uint32_t>::max())
+        , m_storage_handle(std::numeric_limits<uint32_t>::max())
+    {
+        const VkImageCreateInfo image_create_info = VulkanTexture::image_create_info(m_graphics_device, descriptor);
+
+        if (m_memory_heap)
+        {
+            const std::shared_ptr<VulkanMemoryHeap> memory_heap = std::dynamic_pointer_cast<VulkanMemoryHeap>(m_memory_heap);
+            HE_VK_CHECK(vmaCreateAliasingImage2(
+                m_graphics_device.allocator(), memory_heap->allocation(), descriptor.memory_heap_offset, &image_create_info, &m_image));
+            HE_ASSERT(m_image != VK_NULL_HANDLE);
+        }
+        else
+        {
+            const VmaAllocationCreateInfo allocation_create_info = {
+                .flags = 0,
+                .usage = VMA_MEMORY_USAGE_AUTO_PREFER_DEVICE,
+                .requiredFlags = 0,
+                .preferredFlags = 0,
+                .memoryTypeBits = 0,
+                .pool = VK_NULL_HANDLE,
+                .pUserData = nullptr,
+                .priority = 0.0f,
+            };
+
+            VmaAllocationInfo allocation_info = {};
+            HE_VK_CHECK(vmaCreateImage(
+                m_graphics_device.allocator(), &image_create_info, &allocation_create_info, &m_image, &m_allocation, &allocation_info));
+            HE_ASSERT(m_image != VK_NULL_HANDLE);
+            HE_ASSERT(m_allocation != VK_NULL_HANDLE);
+
+            m_graphics_device.memory_budget().track_allocation(MemoryCategory::Texture, allocation_info.size);
+
+            vmaSetAllocationName(m_graphics_device.allocator(), m_allocation, descriptor.label.c_str());
+        }
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_IMAGE, reinterpret_cast<uint64_t>(m_image), descriptor.label);
+
+        this->create_views(descriptor.label);
+
+        m_handle = m_graphics_device.descriptor_manager().allocate_image_handle(
+            DescriptorHeapType::SampledImage, m_sampled_image_view != VK_NULL_HANDLE ? m_sampled_image_view : m_image_view);
+
+        if (m_is_storage)
+        {
+            m_storage_handle = m_graphics_device.descriptor_manager().allocate_image_handle(
+                DescriptorHeapType::StorageImage, m_storage_image_view != VK_NULL_HANDLE ? m_storage_image_view : m_image_view);
+        }
+
+        HE_TRACE(
+            "Created Texture '{}' with {}x{}x{} and {} bytes of texel data",
+            descriptor.label,
+            descriptor.width,
+            descriptor.height,
+            descriptor.depth,
+            texture_byte_size(descriptor));
+    }
+
+    VulkanTexture::VulkanTexture(VulkanGraphicsDevice &graphics_device, const TextureDescriptor &descriptor, const VkImage image)
+        : m_graphics_device(graphics_device)
+        , m_format(descriptor.format)
+        , m_width(descriptor.width)
+        , m_height(descriptor.height)
+        , m_dimension(descriptor.dimension)
+        , m_mip_levels(descriptor.mip_levels)
+        , m_array_layers(descriptor.dimension == TextureDimension::Texture3D ? 1 : descriptor.array_size)
+        , m_is_sampled(false)
+        , m_is_storage(false)
+        , m_image(image)
+        , m_allocation(VK_NULL_HANDLE)
+        , m_memory_heap(nullptr)
+        , m_owned(false)
+        , m_image_view(VK_NULL_HANDLE)
+        , m_sampled_image_view(VK_NULL_HANDLE)
+        , m_storage_image_view(VK_NULL_HANDLE)
+        , m_handle(std::numeric_limits<uint32_t>::max())
+        , m_storage_handle(std::numeric_limits<uint32_t>::max())
+    {
+        HE_ASSERT(m_image != VK_NULL_HANDLE);
+
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_IMAGE, reinterpret_cast<uint64_t>(m_image), descriptor.label);
+
+        // NOTE: Wrapped images are only rendered to, so they don't take up bindless slots
+        this->create_views(descriptor.label);
+    }
+
+    VulkanTexture::~VulkanTexture()
+    {
+        if (m_is_sampled)
+        {
+            m_graphics_device.descriptor_manager().retire_handle(DescriptorHeapType::SampledImage, m_handle);
+        }
+
+        if (m_is_storage)
+        {
+            m_graphics_device.descriptor_manager().retire_handle(DescriptorHeapType::StorageImage, m_storage_handle);
+        }
+
+        if (m_allocation != VK_NULL_HANDLE)
+        {
+            VmaAllocationInfo allocation_info = {};
+            vmaGetAllocationInfo(m_graphics_device.allocator(), m_allocation, &allocation_info);
+
+            m_graphics_device.memory_budget().untrack_allocation(MemoryCategory::Texture, allocation_info.size);
+        }
+
+        // NOTE: Wrapped images are released by their owner after the device went idle, so their view has to go right away
+        if (!m_owned)
+        {
+            vkDestroyImageView(m_graphics_device.device(), m_image_view, nullptr);
+            return;
+        }
+
+        // NOTE: Placed textures only own the image, the heap memory is released with the heap
+        m_graphics_device.deletion_queue().enqueue(
+            [device = m_graphics_device.device(),
+             allocator = m_graphics_device.allocator(),
+             image = m_image,
+             allocation = m_allocation,
+             image_views = std::array<VkImageView, 3>{ m_image_view, m_sampled_image_view, m_storage_image_view }]()
+            {
+                for (const VkImageView image_view : image_views)
+                {
+                    vkDestroyImageView(device, image_view, nullptr);
+                }
+
+                if (allocation == VK_NULL_HANDLE)
+                {
+                    vkDestroyImage(device, image, nullptr);
+                    return;
+                }
+
+                vmaDestroyImage(allocator, image, allocation);
+            });
+    }
+
+    MemoryRequirements VulkanTexture::memory_requirements(const VulkanGraphicsDevice &graphics_device, const TextureDescriptor &descriptor)
+    {
+        const VkImageCreateInfo image_create_info = VulkanTexture::image_create_info(graphics_device, descriptor);
+
+        const VkDeviceImageMemoryRequirements device_image_memory_requirements = {
+            .sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS,
+            .pNext = nullptr,
+            .pCreateInfo = &image_create_info,
+            .planeAspect = VK_IMAGE_ASPECT_NONE,
+        };
+
+        VkMemoryRequirements2 memory_requirements = {
+            .sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2,
+            .pNext = nullptr,
+            .memoryRequirements = {},
+        };
+        vkGetDeviceImageMemoryRequirements(graphics_device.device(), &device_image_memory_requirements, &memory_requirements);
+
+        return {
+            .byte_size = memory_requirements.memoryRequirements.size,
+            .alignment = memory_requirements.memoryRequirements.alignment,
+            .memory_types = memory_requirements.memoryRequirements.memoryTypeBits,
+        };
+    }
+
+    VkImageView VulkanTexture::create_image_view(
+        const VulkanGraphicsDevice &graphics_device,
+        const VkImage image,
+        const TextureFormat format,
+        const TextureDimension dimension,
+        const VkImageSubresourceRange &subresource_range)
+    {
+        const VkImageViewType image_view_type = [&dimension]()
+        {
+            switch (dimension)
+            {
+            case TextureDimension::Texture1D:
+                return VK_IMAGE_VIEW_TYPE_1D;
+            case TextureDimension::Texture1DArray:
+                return VK_IMAGE_VIEW_TYPE_1D_ARRAY;
+            case TextureDimension::Texture2D:
+                return VK_IMAGE_VIEW_TYPE_2D;
+            case TextureDimension::Texture2DArray:
+                return VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+            case TextureDimension::Texture3D:
+                return VK_IMAGE_VIEW_TYPE_3D;
+            case TextureDimension::Unknown:
+            default:
+                HE_UNREACHABLE();
+            }
+        }();
+
+        const VkImageViewCreateInfo image_view_create_info = {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .image = image,
+            .viewType = image_view_type,
+            .format = format_to_vulkan(format),
+            .components =
+                {
+                    .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                    .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                    .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                    .a = VK_COMPONENT_SWIZZLE_IDENTITY,
+                },
+            .subresourceRange = subresource_range,
+        };
+
+        VkImageView image_view = VK_NULL_HANDLE;
+        HE_VK_CHECK(vkCreateImageView(graphics_device.device(), &image_view_create_info, nullptr, &image_view));
+        HE_ASSERT(image_view != VK_NULL_HANDLE);
+
+        return image_view;
+    }
+
+    VkImageAspectFlags VulkanTexture::aspect_mask(const TextureFormat format)
+    {
+        switch (texture_format_info(format).aspect)
+        {
+        case TextureAspect::Color:
+            return VK_IMAGE_ASPECT_COLOR_BIT;
+        case TextureAspect::Depth:
+            return VK_IMAGE_ASPECT_DEPTH_BIT;
+        case TextureAspect::DepthStencil:
+            return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        case TextureAspect::None:
+        default:
+            HE_UNREACHABLE();
+        }
+    }
+
+    VkImage VulkanTexture::image() const
+    {
+        return m_image;
+    }
+
+    VkImageView VulkanTexture::image_view() const
+    {
+        return m_image_view;
+    }
+
+    VmaAllocation VulkanTexture::allocation() const
+    {
+        return m_allocation;
+    }
+
+    VkImageAspectFlags VulkanTexture::aspect_mask() const
+    {
+        return VulkanTexture::aspect_mask(m_format);
+    }
+
+    TextureDimension VulkanTexture::dimension() const
+    {
+        return m_dimension;
+    }
+
+    uint32_t VulkanTexture::mip_levels() const
+    {
+        return m_mip_levels;
+    }
+
+    uint32_t VulkanTexture::array_layers() const
+    {
+        return m_array_layers;
+    }
+
+    bool VulkanTexture::is_sampled() const
+    {
+        return m_is_sampled;
+    }
+
+    bool VulkanTexture::is_storage() const
+    {
+        return m_is_storage;
+    }
+
+    TextureFormat VulkanTexture::format() const
+    {
+        return m_format;
+    }
+
+    uint32_t VulkanTexture::width() const
+    {
+        return m_width;
+    }
+
+    uint32_t VulkanTexture::height() const
+    {
+        return m_height;
+    }
+
+    ResourceHandle VulkanTexture::handle() const
+    {
+        return m_handle;
+    }
+
+    ResourceHandle VulkanTexture::storage_handle() const
+    {
+        return m_storage_handle;
+    }
+
+    VkImageCreateInfo VulkanTexture::image_create_info(const VulkanGraphicsDevice &graphics_device, const TextureDescriptor &descriptor)
+    {
+        const VkImageType image_type = [&descriptor]()
+        {
+            switch (descriptor.dimension)
+            {
+            case TextureDimension::Texture1D:
+            case TextureDimension::Texture1DArray:
+                return VK_IMAGE_TYPE_1D;
+            case TextureDimension::Texture2D:
+            case TextureDimension::Texture2DArray:
+                return VK_IMAGE_TYPE_2D;
+            case TextureDimension::Texture3D:
+                return VK_IMAGE_TYPE_3D;
+            case TextureDimension::Unknown:
+            default:
+                HE_UNREACHABLE();
+            }
+        }();
+
+        const TextureFormatInfo &format_info = texture_format_info(descriptor.format);
+        HE_ASSERT(format_info.aspect != TextureAspect::None);
+
+        const bool is_depth = format_info.aspect != TextureAspect::Color;
+
+        // NOTE: Block compressed formats can only be sampled and copied
+        HE_ASSERT(
+            !texture_format_compressed(descriptor.format) || (!descriptor.is_render_attachment && !descriptor.is_storage),
+            "Compressed texture '{}' can't be rendered to or written as storage",
+            descriptor.label);
+        HE_ASSERT(!is_depth || !descriptor.is_storage, "Depth texture '{}' can't be written as storage", descriptor.label);
+
+        VkImageUsageFlags usage_flags = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        if (descriptor.is_render_attachment)
+        {
+            usage_flags |= is_depth ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT : VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+        }
+
+        if (descriptor.is_storage)
+        {
+            usage_flags |= VK_IMAGE_USAGE_STORAGE_BIT;
+        }
+
+        // NOTE: Textures are shared between the graphics, compute and transfer queues without ownership transfers
+        const std::vector<uint32_t> &queue_family_indices = graphics_device.queue_family_indices();
+        const bool concurrent = queue_family_indices.size() > 1;
+
+        const VkImageCreateInfo image_create_info = {
+            .sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+            .pNext = nullptr,
+            .flags = 0,
+            .imageType = image_type,
+            .format = format_to_vulkan(descriptor.format),
+            .extent =
+                {
+                    .width = descriptor.width,
+                    .height = descriptor.height,
+                    .depth = image_type == VK_IMAGE_TYPE_3D ? descriptor.depth : 1,
+                },
+            .mipLevels = descriptor.mip_levels,
+            .arrayLayers = image_type == VK_IMAGE_TYPE_3D ? 1 : descriptor.array_size,
+            .samples = static_cast<VkSampleCountFlagBits>(descriptor.sample_count),
+            .tiling = VK_IMAGE_TILING_OPTIMAL,
+            .usage = usage_flags,
+            .sharingMode = concurrent ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE,
+            .queueFamilyIndexCount = concurrent ? static_cast<uint32_t>(queue_family_indices.size()) : 0,
+            .pQueueFamilyIndices = concurrent ? queue_family_indices.data() : nullptr,
+            .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        };
+
+        return image_create_info;
+    }
+
+    void VulkanTexture::create_views(const std::string &label)
+    {
+        const VkImageSubresourceRange subresource_range = {
+            .aspectMask = this->aspect_mask(),
+            .baseMipLevel = 0,
+            .levelCount = m_mip_levels,
+            .baseArrayLayer = 0,
+            .layerCount = m_array_layers,
+        };
+
+        m_image_view = VulkanTexture::create_image_view(m_graphics_device, m_image, m_format, m_dimension, subresource_range);
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_IMAGE_VIEW, reinterpret_cast<uint64_t>(m_image_view), fmt::format("{} View", label));
+
+        if (m_is_sampled && texture_format_info(m_format).aspect == TextureAspect::DepthStencil)
+        {
+            VkImageSubresourceRange sampled_subresource_range = subresource_range;
+            sampled_subresource_range.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+
+            m_sampled_image_view = VulkanTexture::create_image_view(m_graphics_device, m_image, m_format, m_dimension, sampled_subresource_range);
+            m_graphics_device.set_object_name(
+                VK_OBJECT_TYPE_IMAGE_VIEW, reinterpret_cast<uint64_t>(m_sampled_image_view), fmt::format("{} Sampled View", label));
+        }
+
+        if (m_is_storage && m_mip_levels > 1)
+        {
+            VkImageSubresourceRange storage_subresource_range = subresource_range;
+            storage_subresource_range.levelCount = 1;
+
+            m_storage_image_view = VulkanTexture::create_image_view(m_graphics_device, m_image, m_format, m_dimension, storage_subresource_range);
+            m_graphics_device.set_object_name(
+                VK_OBJECT_TYPE_IMAGE_VIEW, reinterpret_cast<uint64_t>(m_storage_image_view), fmt::format("{} Storage View", label));
+        }
+    }
+} // namespace hyper_rhi
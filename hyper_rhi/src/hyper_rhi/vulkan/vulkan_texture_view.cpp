@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_texture_view.hpp"
+
+#include <limits>
+
+#include "hyper_rhi/vulkan/vulkan_graphics_device.hpp"
+#include "hyper_rhi/vulkan/vulkan_texture.hpp"
+
+namespace hyper_rhi
+{
+    VulkanTextureView::VulkanTextureView(VulkanGraphicsDevice &graphics_device, const TextureViewDescriptor &descriptor)
+        : m_graphics_device(graphics_device)
+        , m_texture(descriptor.texture)
+        , m_is_sampled(false)
+        , m_is_storage(false)
+        , m_image_view(VK_NULL_HANDLE)
+        , m_handle(std::numeric_limits<uint32_t>::max())
+        , m_storage_handle(std::numeric_limits<uint32_t>::max())
+    {
+        HE_ASSERT(m_texture);
+
+        const std::shared_ptr<VulkanTexture> texture = std::dynamic_pointer_cast<VulkanTexture>(m_texture);
+        HE_ASSERT(texture);
+
+        HE_ASSERT(descriptor.mip_level_count > 0 && descriptor.array_layer_count > 0);
+        HE_ASSERT(
+            descriptor.base_mip_level + descriptor.mip_level_count <= texture->mip_levels(),
+            "Texture view '{}' exceeds the mip levels of its texture",
+            descriptor.label);
+        HE_ASSERT(
+            descriptor.base_array_layer + descriptor.array_layer_count <= texture->array_layers(),
+            "Texture view '{}' exceeds the array layers of its texture",
+            descriptor.label);
+
+        const TextureFormat format = m_texture->format();
+        const TextureDimension dimension = descriptor.dimension != TextureDimension::Unknown ? descriptor.dimension : texture->dimension();
+
+        m_is_sampled = texture->is_sampled();
+        m_is_storage = texture->is_storage() && descriptor.mip_level_count == 1;
+
+        // NOTE: Shaders can only read a single aspect, so depth-stencil views expose the depth
+        const VkImageSubresourceRange subresource_range = {
+            .aspectMask = m_is_sampled ? (VulkanTexture::aspect_mask(format) & ~VK_IMAGE_ASPECT_STENCIL_BIT) : VulkanTexture::aspect_mask(format),
+            .baseMipLevel = descriptor.base_mip_level,
+            .levelCount = descriptor.mip_level_count,
+            .baseArrayLayer = descriptor.base_array_layer,
+            .layerCount = descriptor.array_layer_count,
+        };
+
+        m_image_view = VulkanTexture::create_image_view(m_graphics_device, texture->image(), format, dimension, subresource_range);
+        m_graphics_device.set_object_name(VK_OBJECT_TYPE_IMAGE_VIEW, reinterpret_cast<uint64_t>(m_image_view), descriptor.label);
+
+        if (m_is_sampled)
+        {
+            m_handle = m_graphics_device.descriptor_manager().allocate_image_handle(DescriptorHeapType::SampledImage, m_image_view);
+        }
+
+        if (m_is_storage)
+        {
+            m_storage_handle = m_graphics_device.descriptor_manager().allocate_image_handle(DescriptorHeapType::StorageImage, m_image_view);
+        }
+    }
+
+    VulkanTextureView::~VulkanTextureView()
+    {
+        if (m_is_sampled)
+        {
+            m_graphics_device.descriptor_manager().retire_handle(DescriptorHeapType::SampledImage, m_handle);
+        }
+
+        if (m_is_storage)
+        {
+            m_graphics_device.descriptor_manager().retire_handle(DescriptorHeapType::StorageImage, m_storage_handle);
+        }
+
+        // NOTE: The texture is released after this, so its image is queued behind the view for the same timeline value
+        m_graphics_device.deletion_queue().enqueue(
+            [device = m_graphics_device.device(), image_view = m_image_view]()
+            {
+                vkDestroyImageView(device, image_view, nullptr);
+            });
+    }
+
+    VkImageView VulkanTextureView::image_view() const
+    {
+        return m_image_view;
+    }
+
+    ResourceHandle VulkanTextureView::handle() const
+    {
+        return m_handle;
+    }
+
+    ResourceHandle VulkanTextureView::storage_handle() const
+    {
+        return m_storage_handle;
+    }
+} // namespace hyper_rhi
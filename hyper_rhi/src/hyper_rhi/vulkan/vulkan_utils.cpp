@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hyper_rhi/vulkan/vulkan_utils.hpp"
+
+namespace hyper_rhi
+{
+    VkFormat format_to_vulkan(const TextureFormat format)
+    {
+        switch (format)
+        {
+        case TextureFormat::Unknown:
+            return VK_FORMAT_UNDEFINED;
+        case TextureFormat::R8Unorm:
+            return VK_FORMAT_R8_UNORM;
+        case TextureFormat::R8Snorm:
+            return VK_FORMAT_R8_SNORM;
+        case TextureFormat::R8Uint:
+            return VK_FORMAT_R8_UINT;
+        case TextureFormat::R8Sint:
+            return VK_FORMAT_R8_SINT;
+        case TextureFormat::R8G8Unorm:
+            return VK_FORMAT_R8G8_UNORM;
+        case TextureFormat::R8G8Snorm:
+            return VK_FORMAT_R8G8_SNORM;
+        case TextureFormat::R8G8Uint:
+            return VK_FORMAT_R8G8_UINT;
+        case TextureFormat::R8G8Sint:
+            return VK_FORMAT_R8G8_SINT;
+        case TextureFormat::R8G8B8A8Unorm:
+            return VK_FORMAT_R8G8B8A8_UNORM;
+        case TextureFormat::R8G8B8A8Srgb:
+            return VK_FORMAT_R8G8B8A8_SRGB;
+        case TextureFormat::R8G8B8A8Snorm:
+            return VK_FORMAT_R8G8B8A8_SNORM;
+        case TextureFormat::R8G8B8A8Uint:
+            return VK_FORMAT_R8G8B8A8_UINT;
+        case TextureFormat::R8G8B8A8Sint:
+            return VK_FORMAT_R8G8B8A8_SINT;
+        case TextureFormat::B8G8R8A8Unorm:
+            return VK_FORMAT_B8G8R8A8_UNORM;
+        case TextureFormat::B8G8R8A8Srgb:
+            return VK_FORMAT_B8G8R8A8_SRGB;
+        case TextureFormat::R16Unorm:
+            return VK_FORMAT_R16_UNORM;
+        case TextureFormat::R16Uint:
+            return VK_FORMAT_R16_UINT;
+        case TextureFormat::R16Sint:
+            return VK_FORMAT_R16_SINT;
+        case TextureFormat::R16Sfloat:
+            return VK_FORMAT_R16_SFLOAT;
+        case TextureFormat::R16G16Unorm:
+            return VK_FORMAT_R16G16_UNORM;
+        case TextureFormat::R16G16Uint:
+            return VK_FORMAT_R16G16_UINT;
+        case TextureFormat::R16G16Sint:
+            return VK_FORMAT_R16G16_SINT;
+        case TextureFormat::R16G16Sfloat:
+            return VK_FORMAT_R16G16_SFLOAT;
+        case TextureFormat::R16G16B16A16Unorm:
+            return VK_FORMAT_R16G16B16A16_UNORM;
+        case TextureFormat::R16G16B16A16Uint:
+            return VK_FORMAT_R16G16B16A16_UINT;
+        case TextureFormat::R16G16B16A16Sint:
+            return VK_FORMAT_R16G16B16A16_SINT;
+        case TextureFormat::R16G16B16A16Sfloat:
+            return VK_FORMAT_R16G16B16A16_SFLOAT;
+        case TextureFormat::R32Uint:
+            return VK_FORMAT_R32_UINT;
+        case TextureFormat::R32Sint:
+            return VK_FORMAT_R32_SINT;
+        case TextureFormat::R32Sfloat:
+            return VK_FORMAT_R32_SFLOAT;
+        case TextureFormat::R32G32Uint:
+            return VK_FORMAT_R32G32_UINT;
+        case TextureFormat::R32G32Sint:
+            return VK_FORMAT_R32G32_SINT;
+        case TextureFormat::R32G32Sfloat:
+            return VK_FORMAT_R32G32_SFLOAT;
+        case TextureFormat::R32G32B32A32Uint:
+            return VK_FORMAT_R32G32B32A32_UINT;
+        case TextureFormat::R32G32B32A32Sint:
+            return VK_FORMAT_R32G32B32A32_SINT;
+        case TextureFormat::R32G32B32A32Sfloat:
+            return VK_FORMAT_R32G32B32A32_SFLOAT;
+        case TextureFormat::A2B10G10R10Unorm:
+            return VK_FORMAT_A2B10G10R10_UNORM_PACK32;
+        case TextureFormat::B10G11R11Ufloat:
+            return VK_FORMAT_B10G11R11_UFLOAT_PACK32;
+        case TextureFormat::E5B9G9R9Ufloat:
+            return VK_FORMAT_E5B9G9R9_UFLOAT_PACK32;
+        case TextureFormat::D16Unorm:
+            return VK_FORMAT_D16_UNORM;
+        case TextureFormat::D32Sfloat:
+            return VK_FORMAT_D32_SFLOAT;
+        case TextureFormat::D24UnormS8Uint:
+            return VK_FORMAT_D24_UNORM_S8_UINT;
+        case TextureFormat::D32SfloatS8Uint:
+            return VK_FORMAT_D32_SFLOAT_S8_UINT;
+        case TextureFormat::Bc1Unorm:
+            return VK_FORMAT_BC1_RGBA_UNORM_BLOCK;
+        case TextureFormat::Bc1Srgb:
+            return VK_FORMAT_BC1_RGBA_SRGB_BLOCK;
+        case TextureFormat::Bc2Unorm:
+            return VK_FORMAT_BC2_UNORM_BLOCK;
+        case TextureFormat::Bc2Srgb:
+            return VK_FORMAT_BC2_SRGB_BLOCK;
+        case TextureFormat::Bc3Unorm:
+            return VK_FORMAT_BC3_UNORM_BLOCK;
+        case TextureFormat::Bc3Srgb:
+            return VK_FORMAT_BC3_SRGB_BLOCK;
+        case TextureFormat::Bc4Unorm:
+            return VK_FORMAT_BC4_UNORM_BLOCK;
+        case TextureFormat::Bc4Snorm:
+            return VK_FORMAT_BC4_SNORM_BLOCK;
+        case TextureFormat::Bc5Unorm:
+            return VK_FORMAT_BC5_UNORM_BLOCK;
+        case TextureFormat::Bc5Snorm:
+            return VK_FORMAT_BC5_SNORM_BLOCK;
+        case TextureFormat::Bc6hUfloat:
+            return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        case TextureFormat::Bc6hSfloat:
+            return VK_FORMAT_BC6H_SFLOAT_BLOCK;
+        case TextureFormat::Bc7Unorm:
+            return VK_FORMAT_BC7_UNORM_BLOCK;
+        case TextureFormat::Bc7Srgb:
+            return VK_FORMAT_BC7_SRGB_BLOCK;
+        case TextureFormat::Astc4x4Unorm:
+            return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
+        case TextureFormat::Astc4x4Srgb:
+            return VK_FORMAT_ASTC_4x4_SRGB_BLOCK;
+        case TextureFormat::Astc5x5Unorm:
+            return VK_FORMAT_ASTC_5x5_UNORM_BLOCK;
+        case TextureFormat::Astc5x5Srgb:
+            return VK_FORMAT_ASTC_5x5_SRGB_BLOCK;
+        case TextureFormat::Astc6x6Unorm:
+            return VK_FORMAT_ASTC_6x6_UNORM_BLOCK;
+        case TextureFormat::Astc6x6Srgb:
+            return VK_FORMAT_ASTC_6x6_SRGB_BLOCK;
+        case TextureFormat::Astc8x8Unorm:
+            return VK_FORMAT_ASTC_8x8_UNORM_BLOCK;
+        case TextureFormat::Astc8x8Srgb:
+            return VK_FORMAT_ASTC_8x8_SRGB_BLOCK;
+        case TextureFormat::Astc10x10Unorm:
+            return VK_FORMAT_ASTC_10x10_UNORM_BLOCK;
+        case TextureFormat::Astc10x10Srgb:
+            return VK_FORMAT_ASTC_10x10_SRGB_BLOCK;
+        case TextureFormat::Astc12x12Unorm:
+            return VK_FORMAT_ASTC_12x12_UNORM_BLOCK;
+        case TextureFormat::Astc12x12Srgb:
+            return VK_FORMAT_ASTC_12x12_SRGB_BLOCK;
+        default:
+            HE_UNREACHABLE();
+        }
+    }
+
+    TextureFormat format_from_vulkan(const VkFormat format)
+    {
+        switch (format)
+        {
+        case VK_FORMAT_R8_UNORM:
+            return TextureFormat::R8Unorm;
+        case VK_FORMAT_R8_SNORM:
+            return TextureFormat::R8Snorm;
+        case VK_FORMAT_R8_UINT:
+            return TextureFormat::R8Uint;
+        case VK_FORMAT_R8_SINT:
+            return TextureFormat::R8Sint;
+        case VK_FORMAT_R8G8_UNORM:
+            return TextureFormat::R8G8Unorm;
+        case VK_FORMAT_R8G8_SNORM:
+            return TextureFormat::R8G8Snorm;
+        case VK_FORMAT_R8G8_UINT:
+            return TextureFormat::R8G8Uint;
+        case VK_FORMAT_R8G8_SINT:
+            return TextureFormat::R8G8Sint;
+        case VK_FORMAT_R8G8B8A8_UNORM:
+            return TextureFormat::R8G8B8A8Unorm;
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            return TextureFormat::R8G8B8A8Srgb;
+        case VK_FORMAT_R8G8B8A8_SNORM:
+            return TextureFormat::R8G8B8A8Snorm;
+        case VK_FORMAT_R8G8B8A8_UINT:
+            return TextureFormat::R8G8B8A8Uint;
+        case VK_FORMAT_R8G8B8A8_SINT:
+            return TextureFormat::R8G8B8A8Sint;
+        case VK_FORMAT_B8G8R8A8_UNORM:
+            return TextureFormat::B8G8R8A8Unorm;
+        case VK_FORMAT_B8G8R8A8_SRGB:
+            return TextureFormat::B8G8R8A8Srgb;
+        case VK_FORMAT_R16_UNORM:
+            return TextureFormat::R16Unorm;
+        case VK_FORMAT_R16_UINT:
+            return TextureFormat::R16Uint;
+        case VK_FORMAT_R16_SINT:
+            return TextureFormat::R16Sint;
+        case VK_FORMAT_R16_SFLOAT:
+            return TextureFormat::R16Sfloat;
+        case VK_FORMAT_R16G16_UNORM:
+            return TextureFormat::R16G16Unorm;
+        case VK_FORMAT_R16G16_UINT:
+            return TextureFormat::R16G16Uint;
+        case VK_FORMAT_R16G16_SINT:
+            return TextureFormat::R16G16Sint;
+        case VK_FORMAT_R16G16_SFLOAT:
+            return TextureFormat::R16G16Sfloat;
+        case VK_FORMAT_R16G16B16A16_UNORM:
+            return TextureFormat::R16G16B16A16Unorm;
+        case VK_FORMAT_R16G16B16A16_UINT:
+            return TextureFormat::R16G16B16A16Uint;
+        case VK_FORMAT_R16G16B16A16_SINT:
+            return TextureFormat::R16G16B16A16Sint;
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            return TextureFormat::R16G16B16A16Sfloat;
+        case VK_FORMAT_R32_UINT:
+            return TextureFormat::R32Uint;
+        case VK_FORMAT_R32_SINT:
+            return TextureFormat::R32Sint;
+        case VK_FORMAT_R32_SFLOAT:
+            return TextureFormat::R32Sfloat;
+        case VK_FORMAT_R32G32_UINT:
+            return TextureFormat::R32G32Uint;
+        case VK_FORMAT_R32G32_SINT:
+            return TextureFormat::R32G32Sint;
+        case VK_FORMAT_R32G32_SFLOAT:
+            return TextureFormat::R32G32Sfloat;
+        case VK_FORMAT_R32G32B32A32_UINT:
+            return TextureFormat::R32G32B32A32Uint;
+        case VK_FORMAT_R32G32B32A32_SINT:
+            return TextureFormat::R32G32B32A32Sint;
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+            return TextureFormat::R32G32B32A32Sfloat;
+        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+            return TextureFormat::A2B10G10R10Unorm;
+        case VK_FORMAT_B10G11R11_UFLOAT_PACK32:
+            return TextureFormat::B10G11R11Ufloat;
+        case VK_FORMAT_E5B9G9R9_UFLOAT_PACK32:
+            return TextureFormat::E5B9G9R9Ufloat;
+        case VK_FORMAT_D16_UNORM:
+            return TextureFormat::D16Unorm;
+        case VK_FORMAT_D32_SFLOAT:
+            return TextureFormat::D32Sfloat;
+        case VK_FORMAT_D24_UNORM_S8_UINT:
+            return TextureFormat::D24UnormS8Uint;
+        case VK_FORMAT_D32_SFLOAT_S8_UINT:
+            return TextureFormat::D32SfloatS8Uint;
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+            return TextureFormat::Bc1Unorm;
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+            return TextureFormat::Bc1Srgb;
+        case VK_FORMAT_BC2_UNORM_BLOCK:
+            return TextureFormat::Bc2Unorm;
+        case VK_FORMAT_BC2_SRGB_BLOCK:
+            return TextureFormat::Bc2Srgb;
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+            return TextureFormat::Bc3Unorm;
+        case VK_FORMAT_BC3_SRGB_BLOCK:
+            return TextureFormat::Bc3Srgb;
+        case VK_FORMAT_BC4_UNORM_BLOCK:
+            return TextureFormat::Bc4Unorm;
+        case VK_FORMAT_BC4_SNORM_BLOCK:
+            return TextureFormat::Bc4Snorm;
+        case VK_FORMAT_BC5_UNORM_BLOCK:
+            return TextureFormat::Bc5Unorm;
+        case VK_FORMAT_BC5_SNORM_BLOCK:
+            return TextureFormat::Bc5Snorm;
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+            return TextureFormat::Bc6hUfloat;
+        case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+            return TextureFormat::Bc6hSfloat;
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+            return TextureFormat::Bc7Unorm;
+        case VK_FORMAT_BC7_SRGB_BLOCK:
+            return TextureFormat::Bc7Srgb;
+        case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
+            return TextureFormat::Astc4x4Unorm;
+        case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:
+            return TextureFormat::Astc4x4Srgb;
+        case VK_FORMAT_ASTC_5x5_UNORM_BLOCK:
+            return TextureFormat::Astc5x5Unorm;
+        case VK_FORMAT_ASTC_5x5_SRGB_BLOCK:
+            return TextureFormat::Astc5x5Srgb;
+        case VK_FORMAT_ASTC_6x6_UNORM_BLOCK:
+            return TextureFormat::Astc6x6Unorm;
+        case VK_FORMAT_ASTC_6x6_SRGB_BLOCK:
+            return TextureFormat::Astc6x6Srgb;
+        case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
+            return TextureFormat::Astc8x8Unorm;
+        case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:
+            return TextureFormat::Astc8x8Srgb;
+        case VK_FORMAT_ASTC_10x10_UNORM_BLOCK:
+            return TextureFormat::Astc10x10Unorm;
+        case VK_FORMAT_ASTC_10x10_SRGB_BLOCK:
+            return TextureFormat::Astc10x10Srgb;
+        case VK_FORMAT_ASTC_12x12_UNORM_BLOCK:
+            return TextureFormat::Astc12x12Unorm;
+        case VK_FORMAT_ASTC_12x12_SRGB_BLOCK:
+            return TextureFormat::Astc12x12Srgb;
+        default:
+            return TextureFormat::Unknown;
+        }
+    }
+
+    VkShaderStageFlagBits shader_type_to_vulkan(const ShaderType type)
+    {
+        switch (type)
+        {
+        case ShaderType::Compute:
+            return VK_SHADER_STAGE_COMPUTE_BIT;
+        case ShaderType::Fragment:
+            return VK_SHADER_STAGE_FRAGMENT_BIT;
+        case ShaderType::Vertex:
+            return VK_SHADER_STAGE_VERTEX_BIT;
+        case ShaderType::None:
+        default:
+            HE_UNREACHABLE();
+        }
+    }
+
+    VulkanResourceState resource_state_to_vulkan(const ResourceState state)
+    {
+        constexpr VkPipelineStageFlags2 shader_stages =
+            VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+        constexpr VkPipelineStageFlags2 depth_stages = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+
+        switch (state)
+        {
+        case ResourceState::Undefined:
+            // NOTE: Makes all previous writes available, placed resources may alias memory that was just written by another resource
+            return { VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT, VK_ACCESS_2_MEMORY_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED };
+        case ResourceState::ColorAttachment:
+            return {
+                VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+                VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,
+                VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            };
+        case ResourceState::DepthStencilAttachment:
+            return {
+                depth_stages,
+                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+                VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+            };
+        case ResourceState::DepthStencilRead:
+            return {
+                depth_stages | shader_stages,
+                VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT,
+                VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL,
+            };
+        case ResourceState::ShaderResource:
+            return {
+                shader_stages,
+                VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            };
+        case ResourceState::UnorderedAccess:
+            return {
+                shader_stages,
+                VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+                VK_IMAGE_LAYOUT_GENERAL,
+            };
+        case ResourceState::ConstantBuffer:
+            return { shader_stages, VK_ACCESS_2_UNIFORM_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED };
+        case ResourceState::IndexBuffer:
+            return { VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT, VK_ACCESS_2_INDEX_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED };
+        case ResourceState::IndirectArgument:
+            return { VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED };
+        case ResourceState::TransferSource:
+            return { VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL };
+        case ResourceState::TransferDestination:
+            return { VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL };
+        case ResourceState::Present:
+            return { VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, VK_IMAGE_LAYOUT_PRESENT_SRC_KHR };
+        default:
+            HE_UNREACHABLE();
+        }
+    }
+} // namespace hyper_rhi
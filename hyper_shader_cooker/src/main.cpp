@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024, SkillerRaptor
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <array>
+#include <exception>
+#include <filesystem>
+#include <future>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <argparse/argparse.hpp>
+
+#include <hyper_core/filesystem.hpp>
+#include <hyper_core/logger.hpp>
+#include <hyper_core/thread_pool.hpp>
+#include <hyper_rhi/shader_compiler.hpp>
+
+struct EntryPoint
+{
+    hyper_rhi::ShaderType type;
+    std::string_view name;
+};
+
+// NOTE: Shaders follow the naming convention of opaque_shader.hlsl, every stage present in a file gets cooked
+static constexpr std::array<EntryPoint, 3> s_entry_points = {
+    EntryPoint{
+        .type = hyper_rhi::ShaderType::Compute,
+        .name = "cs_main",
+    },
+    EntryPoint{
+        .type = hyper_rhi::ShaderType::Fragment,
+        .name = "fs_main",
+    },
+    EntryPoint{
+        .type = hyper_rhi::ShaderType::Vertex,
+        .name = "vs_main",
+    },
+};
+
+// NOTE: Mirrors the define sets the renderer compiles with, depending on whether buffer device addresses are available
+static const std::array<std::vector<std::string>, 2> s_define_permutations = {
+    std::vector<std::string>{},
+    std::vector<std::string>{ "HE_BUFFER_DEVICE_ADDRESS" },
+};
+
+int main(int argc, char **argv)
+{
+    argparse::ArgumentParser program("HyperShaderCooker");
+
+    std::string input_directory = "./assets/shaders";
+    program.add_argument("--input").default_value("./assets/shaders").store_into(input_directory);
+
+    std::string cache_directory = "./shader_cache";
+    program.add_argument("--cache").default_value("./shader_cache").store_into(cache_directory);
+
+    std::string renderer = "all";
+    program.add_argument("--renderer").default_value("all").choices("all", "d3d12", "vulkan").store_into(renderer);
+
+    try
+    {
+        program.parse_args(argc, argv);
+    }
+    catch (const std::exception &error)
+    {
+        HE_ERROR("{}", error.what());
+        return 1;
+    }
+
+    std::vector<hyper_rhi::GraphicsApi> graphics_apis;
+    if (renderer == "all" || renderer == "d3d12")
+    {
+        graphics_apis.push_back(hyper_rhi::GraphicsApi::D3D12);
+    }
+
+    if (renderer == "all" || renderer == "vulkan")
+    {
+        graphics_apis.push_back(hyper_rhi::GraphicsApi::Vulkan);
+    }
+
+    const hyper_rhi::ShaderCompiler shader_compiler({
+        .cache_directory = cache_directory,
+    });
+
+    hyper_core::ThreadPool thread_pool;
+
+    std::vector<std::future<bool>> compilations;
+    for (const std::filesystem::directory_entry &entry : std::filesystem::recursive_directory_iterator(input_directory))
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != ".hlsl")
+        {
+            continue;
+        }
+
+        const std::string file_path = entry.path().generic_string();
+        const std::vector<uint8_t> source_bytes = hyper_core::filesystem::read_file(file_path);
+        const std::string_view source(reinterpret_cast<const char *>(source_bytes.data()), source_bytes.size());
+
+        for (const EntryPoint &entry_point : s_entry_points)
+        {
+            if (source.find(entry_point.name) == std::string_view::npos)
+            {
+                continue;
+            }
+
+            for (const hyper_rhi::GraphicsApi graphics_api : graphics_apis)
+            {
+                for (const std::vector<std::string> &defines : s_define_permutations)
+                {
+                    compilations.push_back(thread_pool.submit(
+                        [&shader_compiler, file_path, entry_point, graphics_api, &defines]()
+                        {
+                            return shader_compiler
+                                .compile({
+                                    .graphics_api = graphics_api,
+                                    .file_path = file_path,
+                                    .type = entry_point.type,
+                                    .entry_name = std::string(entry_point.name),
+                                    .defines = defines,
+                                })
+                                .has_value();
+                        }));
+                }
+            }
+        }
+    }
+
+    size_t failure_count = 0;
+    for (std::future<bool> &compilation : compilations)
+    {
+        if (!compilation.get())
+        {
+            ++failure_count;
+        }
+    }
+
+    if (failure_count > 0)
+    {
+        HE_ERROR("Failed to cook {} of {} shaders", failure_count, compilations.size());
+        return 1;
+    }
+
+    HE_INFO("Cooked {} shaders into '{}'", compilations.size(), cache_directory);
+
+    return 0;
+}